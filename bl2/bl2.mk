@@ -1,5 +1,5 @@
 #
-# Copyright (c) 2013-2024, Arm Limited and Contributors. All rights reserved.
+# Copyright (c) 2013-2026, Arm Limited and Contributors. All rights reserved.
 #
 # SPDX-License-Identifier: BSD-3-Clause
 #
@@ -50,6 +50,14 @@ endif
 BL2_DEFAULT_LINKER_SCRIPT_SOURCE := bl2/bl2_el3.ld.S
 endif
 
+ifeq (${BL2_PARALLEL_AUTH},1)
+# Secondary CPUs help authenticating images, each one needs its own stack
+BL2_SOURCES		:=	$(filter-out plat/common/${ARCH}/platform_up_stack.S,${BL2_SOURCES})
+BL2_SOURCES		+=	bl2/bl2_auth.c					\
+				bl2/${ARCH}/bl2_auth_entrypoint.S		\
+				plat/common/${ARCH}/platform_mp_stack.S
+endif
+
 ifeq (${ENABLE_PMF},1)
 BL2_SOURCES		+=	lib/pmf/pmf_main.c
 endif
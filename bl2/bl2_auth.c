@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <arch_helpers.h>
+#include <common/bl_common.h>
+#include <common/debug.h>
+#include <lib/spinlock.h>
+#include <plat/common/platform.h>
+
+#include <platform_def.h>
+
+#include "bl2_private.h"
+
+/*
+ * Number of images that can be waiting for authentication at the same time.
+ * The image load loop keeps at most two images in flight.
+ */
+#define BL2_AUTH_MAX_JOBS	4U
+
+/* States of an authentication job */
+#define AUTH_JOB_FREE		0U
+#define AUTH_JOB_PENDING	1U
+#define AUTH_JOB_RUNNING	2U
+#define AUTH_JOB_DONE		3U
+
+struct bl2_auth_job {
+	unsigned int state;
+	unsigned int seq;
+	unsigned int image_id;
+	const image_info_t *image_data;
+	int result;
+};
+
+static struct bl2_auth_job auth_jobs[BL2_AUTH_MAX_JOBS];
+static unsigned int auth_jobs_seq;
+static bool auth_workers_stop;
+static spinlock_t auth_jobs_lock;
+static unsigned int auth_workers;
+
+/*
+ * Set by each worker with the MMU and data cache disabled once it no longer
+ * uses BL2 memory, so it is only ever read by the primary CPU after
+ * invalidating it from the data cache.
+ */
+uint8_t bl2_auth_worker_parked[PLATFORM_CORE_COUNT];
+
+/*
+ * Return the oldest pending job, or NULL if there is none. Must be called with
+ * the jobs lock held.
+ */
+static struct bl2_auth_job *auth_job_next(void)
+{
+	struct bl2_auth_job *next = NULL;
+	unsigned int i;
+
+	for (i = 0U; i < BL2_AUTH_MAX_JOBS; i++) {
+		if ((auth_jobs[i].state == AUTH_JOB_PENDING) &&
+		    ((next == NULL) ||
+		     ((int)(auth_jobs[i].seq - next->seq) < 0))) {
+			next = &auth_jobs[i];
+		}
+	}
+
+	return next;
+}
+
+/*******************************************************************************
+ * Main loop of the secondary CPUs released to authenticate images. It returns
+ * once the primary CPU has called bl2_auth_workers_stop(), after which the
+ * caller puts the CPU back in its platform-specific holding pen.
+ ******************************************************************************/
+void bl2_auth_worker_main(void)
+{
+	struct bl2_auth_job *job;
+	int rc;
+
+	for (;;) {
+		spin_lock(&auth_jobs_lock);
+		job = auth_job_next();
+		if (job != NULL) {
+			job->state = AUTH_JOB_RUNNING;
+		} else if (auth_workers_stop) {
+			spin_unlock(&auth_jobs_lock);
+			return;
+		}
+		spin_unlock(&auth_jobs_lock);
+
+		if (job == NULL) {
+			/* Woken up by bl2_load_auth_image_async() or workers stop */
+			wfe();
+			continue;
+		}
+
+		rc = auth_loaded_image(job->image_id, job->image_data);
+
+		spin_lock(&auth_jobs_lock);
+		job->result = rc;
+		job->state = AUTH_JOB_DONE;
+		spin_unlock(&auth_jobs_lock);
+
+		dsbish();
+		sev();
+	}
+}
+
+/*******************************************************************************
+ * Release the secondary CPUs which authenticate images on behalf of the
+ * primary CPU. If the platform does not release any, images are authenticated
+ * on the primary CPU as they are loaded.
+ ******************************************************************************/
+void bl2_auth_workers_start(void)
+{
+	int rc;
+
+	/* Workers write their parked flag with the data cache disabled */
+	flush_dcache_range((uintptr_t)bl2_auth_worker_parked,
+			   sizeof(bl2_auth_worker_parked));
+
+	rc = bl2_el3_plat_release_secondaries(
+			(uintptr_t)bl2_auth_worker_entrypoint);
+	if (rc <= 0) {
+		INFO("BL2: Authenticating images on the primary CPU\n");
+		return;
+	}
+
+	auth_workers = (unsigned int)rc;
+	INFO("BL2: Authenticating images on %u secondary CPU(s)\n",
+	     auth_workers);
+}
+
+/*******************************************************************************
+ * Wait until the released secondary CPUs have left BL2, which must happen
+ * before BL2 exits as its memory may then be reused.
+ ******************************************************************************/
+void bl2_auth_workers_stop(void)
+{
+	unsigned int i, parked;
+
+	if (auth_workers == 0U) {
+		return;
+	}
+
+	spin_lock(&auth_jobs_lock);
+	auth_workers_stop = true;
+	spin_unlock(&auth_jobs_lock);
+
+	dsbish();
+	sev();
+
+	do {
+		inv_dcache_range((uintptr_t)bl2_auth_worker_parked,
+				 sizeof(bl2_auth_worker_parked));
+
+		parked = 0U;
+		for (i = 0U; i < PLATFORM_CORE_COUNT; i++) {
+			parked += bl2_auth_worker_parked[i];
+		}
+	} while (parked < auth_workers);
+
+	auth_workers = 0U;
+}
+
+/*******************************************************************************
+ * Load an image and queue its authentication on a secondary CPU. The image is
+ * authenticated right away when no secondary CPU is available.
+ ******************************************************************************/
+int bl2_load_auth_image_async(unsigned int image_id, image_info_t *image_data)
+{
+	struct bl2_auth_job *job = NULL;
+	unsigned int i;
+	int rc;
+
+	/* Alternate image instances can only be tried sequentially */
+	if ((auth_workers == 0U) ||
+	    ((plat_try_img_ops != NULL) &&
+	     (plat_try_img_ops->next_instance != NULL))) {
+		return load_auth_image(image_id, image_data);
+	}
+
+	rc = load_image_auth_parents(image_id, image_data);
+	if (rc != 0) {
+		return rc;
+	}
+
+	spin_lock(&auth_jobs_lock);
+	for (i = 0U; i < BL2_AUTH_MAX_JOBS; i++) {
+		if (auth_jobs[i].state == AUTH_JOB_FREE) {
+			job = &auth_jobs[i];
+			job->state = AUTH_JOB_PENDING;
+			job->seq = auth_jobs_seq++;
+			job->image_id = image_id;
+			job->image_data = image_data;
+			break;
+		}
+	}
+	spin_unlock(&auth_jobs_lock);
+
+	if (job == NULL) {
+		rc = auth_loaded_image(image_id, image_data);
+		if (rc != 0) {
+			return rc;
+		}
+
+		return measure_loaded_image(image_id, image_data);
+	}
+
+	dsbish();
+	sev();
+
+	return 0;
+}
+
+/*******************************************************************************
+ * Wait for the authentication of an image queued by
+ * bl2_load_auth_image_async() and measure it. Returns immediately if the image
+ * has not been queued.
+ ******************************************************************************/
+int bl2_auth_image_wait(unsigned int image_id, image_info_t *image_data)
+{
+	struct bl2_auth_job *job = NULL;
+	unsigned int i;
+	int rc;
+
+	for (i = 0U; i < BL2_AUTH_MAX_JOBS; i++) {
+		if ((auth_jobs[i].state != AUTH_JOB_FREE) &&
+		    (auth_jobs[i].image_id == image_id)) {
+			job = &auth_jobs[i];
+			break;
+		}
+	}
+
+	if (job == NULL) {
+		return 0;
+	}
+
+	for (;;) {
+		spin_lock(&auth_jobs_lock);
+		if (job->state == AUTH_JOB_DONE) {
+			rc = job->result;
+			job->state = AUTH_JOB_FREE;
+			spin_unlock(&auth_jobs_lock);
+			break;
+		}
+		spin_unlock(&auth_jobs_lock);
+
+		wfe();
+	}
+
+	if (rc != 0) {
+		return rc;
+	}
+
+	return measure_loaded_image(image_id, image_data);
+}
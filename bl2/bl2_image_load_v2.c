@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2022, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2016-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -14,10 +14,42 @@
 #include <common/debug.h>
 #include <common/desc_image_load.h>
 #include <drivers/auth/auth_mod.h>
+#include <lib/bootmarker_capture.h>
+#include <lib/pmf/pmf.h>
 #include <plat/common/platform.h>
 
 #include <platform_def.h>
 
+#if BL2_PARALLEL_AUTH && ENABLE_RUNTIME_INSTRUMENTATION
+PMF_DECLARE_CAPTURE_TIMESTAMP(bl_svc)
+#endif
+
+/*******************************************************************************
+ * This function completes the handling of a loaded image.
+ ******************************************************************************/
+static void bl2_post_image_load(const bl_load_info_node_t *bl2_node_info)
+{
+	int err;
+
+#if BL2_PARALLEL_AUTH
+	/* Wait for the image to be authenticated before using it */
+	err = bl2_auth_image_wait(bl2_node_info->image_id,
+				  bl2_node_info->image_info);
+	if (err != 0) {
+		ERROR("BL2: Failed to load image id %u (%i)\n",
+		      bl2_node_info->image_id, err);
+		plat_error_handler(err);
+	}
+#endif /* BL2_PARALLEL_AUTH */
+
+	/* Allow platform to handle image information. */
+	err = bl2_plat_handle_post_image_load(bl2_node_info->image_id);
+	if (err != 0) {
+		ERROR("BL2: Failure in post image load handling (%i)\n", err);
+		plat_error_handler(err);
+	}
+}
+
 /*******************************************************************************
  * This function loads SCP_BL2/BL3x images and returns the ep_info for
  * the next executable image.
@@ -27,6 +59,9 @@ struct entry_point_info *bl2_load_images(void)
 	bl_params_t *bl2_to_next_bl_params;
 	bl_load_info_t *bl2_load_info;
 	const bl_load_info_node_t *bl2_node_info;
+#if BL2_DEFER_POST_IMAGE_LOAD
+	const bl_load_info_node_t *bl2_prev_node_info = NULL;
+#endif
 	int plat_setup_done = 0;
 	int err;
 
@@ -40,6 +75,10 @@ struct entry_point_info *bl2_load_images(void)
 	assert(bl2_load_info->h.version >= VERSION_2);
 	bl2_node_info = bl2_load_info->head;
 
+#if BL2_PARALLEL_AUTH
+	bl2_auth_workers_start();
+#endif
+
 	while (bl2_node_info != NULL) {
 		/*
 		 * Perform platform setup before loading the image,
@@ -66,8 +105,13 @@ struct entry_point_info *bl2_load_images(void)
 		if ((bl2_node_info->image_info->h.attr &
 		    IMAGE_ATTRIB_SKIP_LOADING) == 0U) {
 			INFO("BL2: Loading image id %u\n", bl2_node_info->image_id);
+#if BL2_PARALLEL_AUTH
+			err = bl2_load_auth_image_async(bl2_node_info->image_id,
+				bl2_node_info->image_info);
+#else
 			err = load_auth_image(bl2_node_info->image_id,
 				bl2_node_info->image_info);
+#endif
 			if (err != 0) {
 				ERROR("BL2: Failed to load image id %u (%i)\n",
 				      bl2_node_info->image_id, err);
@@ -77,17 +121,39 @@ struct entry_point_info *bl2_load_images(void)
 			INFO("BL2: Skip loading image id %u\n", bl2_node_info->image_id);
 		}
 
-		/* Allow platform to handle image information. */
-		err = bl2_plat_handle_post_image_load(bl2_node_info->image_id);
-		if (err != 0) {
-			ERROR("BL2: Failure in post image load handling (%i)\n", err);
-			plat_error_handler(err);
+#if BL2_DEFER_POST_IMAGE_LOAD
+		/*
+		 * The previous image has been authenticated while this one was
+		 * being loaded, so its handling can now be completed.
+		 */
+		if (bl2_prev_node_info != NULL) {
+			bl2_post_image_load(bl2_prev_node_info);
 		}
+		bl2_prev_node_info = bl2_node_info;
+#else
+		bl2_post_image_load(bl2_node_info);
+#endif
 
 		/* Go to next image */
 		bl2_node_info = bl2_node_info->next_load_info;
 	}
 
+#if BL2_PARALLEL_AUTH
+#if ENABLE_RUNTIME_INSTRUMENTATION
+	PMF_CAPTURE_TIMESTAMP(bl_svc, BL2_LOAD_DONE, PMF_CACHE_MAINT);
+#endif
+#if BL2_DEFER_POST_IMAGE_LOAD
+	if (bl2_prev_node_info != NULL) {
+		bl2_post_image_load(bl2_prev_node_info);
+	}
+#endif
+#if ENABLE_RUNTIME_INSTRUMENTATION
+	PMF_CAPTURE_TIMESTAMP(bl_svc, BL2_AUTH_DONE, PMF_CACHE_MAINT);
+#endif
+
+	bl2_auth_workers_stop();
+#endif /* BL2_PARALLEL_AUTH */
+
 	/*
 	 * Get information to pass to the next image.
 	 */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2018, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -21,4 +21,13 @@ void bl2_arch_setup(void);
 struct entry_point_info *bl2_load_images(void);
 void bl2_run_next_image(const struct entry_point_info *bl_ep_info);
 
+#if BL2_PARALLEL_AUTH
+void bl2_auth_worker_entrypoint(void);
+void bl2_auth_worker_main(void);
+void bl2_auth_workers_start(void);
+void bl2_auth_workers_stop(void);
+int bl2_load_auth_image_async(unsigned int image_id, image_info_t *image_data);
+int bl2_auth_image_wait(unsigned int image_id, image_info_t *image_data);
+#endif /* BL2_PARALLEL_AUTH */
+
 #endif /* BL2_PRIVATE_H */
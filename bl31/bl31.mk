@@ -1,5 +1,5 @@
 #
-# Copyright (c) 2013-2024, Arm Limited and Contributors. All rights reserved.
+# Copyright (c) 2013-2026, Arm Limited and Contributors. All rights reserved.
 #
 # SPDX-License-Identifier: BSD-3-Clause
 #
@@ -61,6 +61,20 @@ BL31_SOURCES		+=	lib/pmf/pmf_main.c				\
 				${VENDOR_EL3_SRCS}
 endif
 
+ifeq (${ENABLE_SMC_STATS},1)
+BL31_SOURCES		+=	lib/pmf/pmf_smc_stats.c
+endif
+
+ifeq (${ENABLE_LOCK_STATS},1)
+BL31_SOURCES		+=	lib/locks/lock_stats.c				\
+				${VENDOR_EL3_SRCS}
+endif
+
+ifeq (${ENABLE_SMC_BATCH},1)
+BL31_SOURCES		+=	services/el3/smc_batch.c			\
+				${VENDOR_EL3_SRCS}
+endif
+
 include lib/debugfs/debugfs.mk
 ifeq (${USE_DEBUGFS},1)
 BL31_SOURCES		+=	${DEBUGFS_SRCS}					\
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, Arm Limited. All rights reserved.
+ * Copyright (c) 2022-2026, Arm Limited. All rights reserved.
  * Copyright (c) 2023, NVIDIA Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
@@ -217,6 +217,7 @@ void inject_undef64(cpu_context_t *ctx)
 	unsigned int to_el = target_el(GET_EL(old_spsr), scr_el3);
 
 	if (to_el == MODE_EL2) {
+		cm_el2_sysregs_live_invalidate();
 		write_elr_el2(elr_el3);
 		elr_el3 = get_elr_el3(old_spsr, read_vbar_el2(), to_el);
 		write_esr_el2(esr);
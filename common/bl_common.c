@@ -1,11 +1,12 @@
 /*
- * Copyright (c) 2013-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <assert.h>
 #include <errno.h>
+#include <stdbool.h>
 #include <string.h>
 
 #include <arch.h>
@@ -16,6 +17,7 @@
 #include <common/debug.h>
 #include <drivers/auth/auth_mod.h>
 #include <drivers/io/io_storage.h>
+#include <lib/spinlock.h>
 #include <lib/utils.h>
 #include <lib/xlat_tables/xlat_tables_defs.h>
 #include <plat/common/platform.h>
@@ -48,6 +50,44 @@ static int dyn_is_auth_disabled(void)
 }
 #endif /* TRUSTED_BOARD_BOOT */
 
+#if BL2_PARALLEL_AUTH && defined(IMAGE_BL2)
+/*
+ * Images may be authenticated on a secondary CPU while the primary CPU loads
+ * the next ones. The crypto library is not reentrant, so the authentication
+ * and measurement of images are serialised with this lock.
+ */
+static spinlock_t auth_lock;
+#endif /* BL2_PARALLEL_AUTH && IMAGE_BL2 */
+
+static void auth_lock_acquire(void)
+{
+#if BL2_PARALLEL_AUTH && defined(IMAGE_BL2)
+	spin_lock(&auth_lock);
+#endif
+}
+
+static void auth_lock_release(void)
+{
+#if BL2_PARALLEL_AUTH && defined(IMAGE_BL2)
+	spin_unlock(&auth_lock);
+#endif
+}
+
+/*
+ * Images authenticated by hash are hashed as they are read, unless they may be
+ * encrypted, in which case the whole image must be read at once to decrypt it.
+ */
+#if TRUSTED_BOARD_BOOT && defined(DECRYPTION_SUPPORT_none)
+#define LOAD_IMAGE_HASH_STREAM	1
+#else
+#define LOAD_IMAGE_HASH_STREAM	0
+#endif
+
+/* Size of the chunks in which images are hashed as they are read */
+#ifndef PLAT_IMAGE_LOAD_CHUNK_SIZE
+#define PLAT_IMAGE_LOAD_CHUNK_SIZE	(64U * 1024U)
+#endif
+
 uintptr_t page_align(uintptr_t value, unsigned dir)
 {
 	/* Round up the limit to the next page boundary */
@@ -60,6 +100,60 @@ uintptr_t page_align(uintptr_t value, unsigned dir)
 	return value;
 }
 
+/*******************************************************************************
+ * Internal function to read an image into memory. If 'stream_auth' is set and
+ * the image is authenticated by hash, the image is read in chunks which are
+ * hashed while still in the data cache, rather than hashed in one pass once
+ * the whole image has been read.
+ ******************************************************************************/
+static int read_image(unsigned int image_id, uintptr_t image_handle,
+		      uintptr_t image_base, size_t image_size,
+		      size_t *bytes_read, bool stream_auth)
+{
+#if LOAD_IMAGE_HASH_STREAM
+	size_t chunk_size, chunk_read;
+	int io_result;
+	int rc;
+
+	if (stream_auth && (dyn_is_auth_disabled() == 0)) {
+		auth_lock_acquire();
+		rc = auth_mod_hash_start(image_id);
+		auth_lock_release();
+	} else {
+		rc = 1;
+	}
+
+	if (rc == 0) {
+		*bytes_read = 0U;
+		while (*bytes_read < image_size) {
+			chunk_size = MIN(image_size - *bytes_read,
+					 (size_t)PLAT_IMAGE_LOAD_CHUNK_SIZE);
+			io_result = io_read(image_handle,
+					    image_base + *bytes_read,
+					    chunk_size, &chunk_read);
+			if ((io_result != 0) || (chunk_read == 0U)) {
+				auth_lock_acquire();
+				auth_mod_hash_cancel();
+				auth_lock_release();
+				return io_result;
+			}
+
+			auth_lock_acquire();
+			auth_mod_hash_update(image_id,
+					     (void *)(image_base + *bytes_read),
+					     (unsigned int)chunk_read);
+			auth_lock_release();
+
+			*bytes_read += chunk_read;
+		}
+
+		return 0;
+	}
+#endif /* LOAD_IMAGE_HASH_STREAM */
+
+	return io_read(image_handle, image_base, image_size, bytes_read);
+}
+
 /*******************************************************************************
  * Internal function to load an image at a specific address given
  * an image ID and extents of free memory.
@@ -68,7 +162,8 @@ uintptr_t page_align(uintptr_t value, unsigned dir)
  *
  * Returns 0 on success, a negative error code otherwise.
  ******************************************************************************/
-static int load_image(unsigned int image_id, image_info_t *image_data)
+static int load_image(unsigned int image_id, image_info_t *image_data,
+		      bool stream_auth)
 {
 	uintptr_t dev_handle;
 	uintptr_t image_handle;
@@ -124,7 +219,8 @@ static int load_image(unsigned int image_id, image_info_t *image_data)
 
 	/* We have enough space so load the image now */
 	/* TODO: Consider whether to try to recover/retry a partially successful read */
-	io_result = io_read(image_handle, image_base, image_size, &bytes_read);
+	io_result = read_image(image_id, image_handle, image_base, image_size,
+			       &bytes_read, stream_auth);
 	if ((io_result != 0) || (bytes_read < image_size)) {
 		WARN("Failed to load image id=%u (%i)\n", image_id, io_result);
 		goto exit;
@@ -145,6 +241,32 @@ exit:
 }
 
 #if TRUSTED_BOARD_BOOT
+/*
+ * This function authenticates an image which has already been loaded, once its
+ * parent images have been authenticated.
+ */
+static int auth_image(unsigned int image_id, const image_info_t *image_data)
+{
+	int rc;
+
+	auth_lock_acquire();
+	rc = auth_mod_verify_img(image_id,
+				 (void *)image_data->image_base,
+				 image_data->image_size);
+	auth_lock_release();
+
+	if (rc != 0) {
+		/* Authentication error, zero memory and flush it right away. */
+		zero_normalmem((void *)image_data->image_base,
+			       image_data->image_size);
+		flush_dcache_range(image_data->image_base,
+				   image_data->image_size);
+		return -EAUTH;
+	}
+
+	return 0;
+}
+
 /*
  * This function uses recursion to authenticate the parent images up to the root
  * of trust.
@@ -166,25 +288,13 @@ static int load_auth_image_recursive(unsigned int image_id,
 	}
 
 	/* Load the image */
-	rc = load_image(image_id, image_data);
+	rc = load_image(image_id, image_data, true);
 	if (rc != 0) {
 		return rc;
 	}
 
 	/* Authenticate it */
-	rc = auth_mod_verify_img(image_id,
-				 (void *)image_data->image_base,
-				 image_data->image_size);
-	if (rc != 0) {
-		/* Authentication error, zero memory and flush it right away. */
-		zero_normalmem((void *)image_data->image_base,
-			       image_data->image_size);
-		flush_dcache_range(image_data->image_base,
-				   image_data->image_size);
-		return -EAUTH;
-	}
-
-	return 0;
+	return auth_image(image_id, image_data);
 }
 #endif /* TRUSTED_BOARD_BOOT */
 
@@ -197,7 +307,7 @@ static int load_auth_image_internal(unsigned int image_id,
 	}
 #endif
 
-	return load_image(image_id, image_data);
+	return load_image(image_id, image_data, false);
 }
 
 /*******************************************************************************
@@ -230,7 +340,9 @@ int load_auth_image(unsigned int image_id, image_info_t *image_data)
 		 * authentication in case of Trusted-Boot flow) then measure
 		 * it (if MEASURED_BOOT flag is enabled).
 		 */
+		auth_lock_acquire();
 		err = plat_mboot_measure_image(image_id, image_data);
+		auth_lock_release();
 		if (err != 0) {
 			return err;
 		}
@@ -246,6 +358,70 @@ int load_auth_image(unsigned int image_id, image_info_t *image_data)
 	return err;
 }
 
+#if BL2_PARALLEL_AUTH && defined(IMAGE_BL2)
+/*******************************************************************************
+ * Load an image and authenticate its parent images (if TBB is enabled), but not
+ * the image itself. The image must then be authenticated by calling
+ * 'auth_loaded_image()', possibly on another CPU, before being measured and
+ * used. Platforms providing alternate image instances through
+ * 'plat_try_img_ops' are not supported.
+ ******************************************************************************/
+int load_image_auth_parents(unsigned int image_id, image_info_t *image_data)
+{
+#if TRUSTED_BOARD_BOOT
+	unsigned int parent_id;
+	int rc;
+
+	if ((dyn_is_auth_disabled() == 0) &&
+	    (auth_mod_get_parent_id(image_id, &parent_id) == 0)) {
+		rc = load_auth_image_recursive(parent_id, image_data, 1);
+		if (rc != 0) {
+			return rc;
+		}
+	}
+#endif /* TRUSTED_BOARD_BOOT */
+
+	/* The image is authenticated on another CPU, it is hashed there too */
+	return load_image(image_id, image_data, false);
+}
+
+/*******************************************************************************
+ * Authenticate an image loaded by 'load_image_auth_parents()'. Returns -EAUTH
+ * and zeroes the image if the authentication fails. This function may be called
+ * on any CPU with the MMU and data cache enabled.
+ ******************************************************************************/
+int auth_loaded_image(unsigned int image_id, const image_info_t *image_data)
+{
+#if TRUSTED_BOARD_BOOT
+	if (dyn_is_auth_disabled() == 0) {
+		return auth_image(image_id, image_data);
+	}
+#endif /* TRUSTED_BOARD_BOOT */
+
+	return 0;
+}
+
+/*******************************************************************************
+ * Measure an image authenticated by 'auth_loaded_image()' and flush it to main
+ * memory, which completes what 'load_auth_image()' does.
+ ******************************************************************************/
+int measure_loaded_image(unsigned int image_id, image_info_t *image_data)
+{
+	int err;
+
+	auth_lock_acquire();
+	err = plat_mboot_measure_image(image_id, image_data);
+	auth_lock_release();
+	if (err != 0) {
+		return err;
+	}
+
+	flush_dcache_range(image_data->image_base, image_data->image_size);
+
+	return 0;
+}
+#endif /* BL2_PARALLEL_AUTH && IMAGE_BL2 */
+
 /*******************************************************************************
  * Print the content of an entry_point_info_t structure.
  ******************************************************************************/
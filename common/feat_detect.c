@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2022-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -171,6 +171,11 @@ static unsigned int read_feat_rng_id_field(void)
 	return ISOLATE_FIELD(read_id_aa64isar0_el1(), ID_AA64ISAR0_RNDR_SHIFT,
 			     ID_AA64ISAR0_RNDR_MASK);
 }
+static unsigned int read_feat_sha2_id_field(void)
+{
+	return ISOLATE_FIELD(read_id_aa64isar0_el1(), ID_AA64ISAR0_SHA2_SHIFT,
+			     ID_AA64ISAR0_SHA2_MASK);
+}
 static unsigned int read_feat_fgt_id_field(void)
 {
 	return ISOLATE_FIELD(read_id_aa64mmfr0_el1(), ID_AA64MMFR0_EL1_FGT_SHIFT,
@@ -288,6 +293,8 @@ void detect_arch_features(void)
 	check_feature(ENABLE_FEAT_SB, read_feat_sb_id_field(), "SB", 1, 1);
 	check_feature(ENABLE_FEAT_CSV2_2, read_feat_csv2_id_field(),
 		      "CSV2_2", 2, 3);
+	check_feature(ENABLE_FEAT_SHA256, read_feat_sha2_id_field(),
+		      "SHA256", 1, 2);
 	/*
 	 * Even though the PMUv3 is an OPTIONAL feature, it is always
 	 * implemented and Arm prescribes so. So assume it will be there and do
@@ -305,6 +312,8 @@ void detect_arch_features(void)
 	check_feature(ENABLE_SVE_FOR_NS, read_feat_sve_id_field(),
 		      "SVE", 1, 1);
 	check_feature(ENABLE_FEAT_RAS, read_feat_ras_id_field(), "RAS", 1, 2);
+	check_feature(ENABLE_FEAT_SHA512, read_feat_sha2_id_field(),
+		      "SHA512", 2, 2);
 
 	/* v8.3 features */
 	/* TODO: Pauth yet to convert to tri-state feat detect logic */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2019, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -27,7 +27,8 @@ uint8_t rt_svc_descs_indices[MAX_RT_SVCS];
 
 /*******************************************************************************
  * Function to invoke the registered `handle` corresponding to the smc_fid in
- * AArch32 mode.
+ * AArch32 mode. In AArch64 mode, it is also used by the SMC batch service to
+ * run the calls of a batch.
  ******************************************************************************/
 uintptr_t handle_runtime_svc(uint32_t smc_fid,
 			     void *cookie,
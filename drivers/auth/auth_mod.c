@@ -1,10 +1,11 @@
 /*
- * Copyright (c) 2015-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <assert.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -27,6 +28,28 @@
 
 #pragma weak plat_set_nv_ctr2
 
+/*
+ * State of the hash of an image computed while the image is being loaded, see
+ * auth_mod_hash_start().
+ */
+static struct {
+	unsigned int img_id;
+	unsigned int len;
+	bool active;
+} img_hash_stream;
+
+/*
+ * Stop hashing the image being loaded, releasing the resources held by the
+ * crypto library
+ */
+static void img_hash_stream_abort(void)
+{
+	if (img_hash_stream.active) {
+		img_hash_stream.active = false;
+		crypto_mod_verify_hash_abort();
+	}
+}
+
 static int cmp_auth_param_type_desc(const auth_param_type_desc_t *a,
 		const auth_param_type_desc_t *b)
 {
@@ -113,6 +136,27 @@ static int auth_hash(const auth_method_param_hash_t *param,
 		return rc;
 	}
 
+	/*
+	 * If the data has been hashed as it was loaded, only the comparison is
+	 * left to do. The expected hash was obtained from the same, already
+	 * authenticated, parent image.
+	 */
+	if (img_hash_stream.active &&
+	    (img_hash_stream.img_id == img_desc->img_id)) {
+		if ((data_ptr == img) && (data_len == img_hash_stream.len)) {
+			img_hash_stream.active = false;
+			rc = crypto_mod_verify_hash_finish();
+			if (rc != 0) {
+				VERBOSE("[TBB] %s():%d failed with error code %d.\n",
+					__func__, __LINE__, rc);
+			}
+			return rc;
+		}
+
+		/* Fall back to hashing the whole image */
+		img_hash_stream_abort();
+	}
+
 	/* Ask the crypto module to verify this hash */
 	rc = crypto_mod_verify_hash(data_ptr, data_len,
 				    hash_der_ptr, hash_der_len);
@@ -436,6 +480,89 @@ int auth_mod_get_parent_id(unsigned int img_id, unsigned int *parent_id)
 	return 0;
 }
 
+/*
+ * Prepare for hashing an image as it is loaded, with auth_mod_hash_update()
+ * called on each chunk of data loaded, in order. The hash is then compared when
+ * the image is verified. This is only possible for raw images authenticated by
+ * hash, whose parent has already been authenticated.
+ *
+ * Return value:
+ *   0 = Image is hashed as it is loaded, Otherwise = image is hashed when it
+ *   is verified
+ */
+int auth_mod_hash_start(unsigned int img_id)
+{
+	const auth_img_desc_t *img_desc;
+	const auth_method_desc_t *auth_method;
+	void *hash_der_ptr;
+	unsigned int hash_der_len;
+	int i;
+
+	img_hash_stream_abort();
+
+	img_desc = FCONF_GET_PROPERTY(tbbr, cot, img_id);
+	if ((img_desc->img_type != IMG_RAW) ||
+	    (img_desc->img_auth_methods == NULL) ||
+	    (img_desc->parent == NULL) ||
+	    ((auth_img_flags[img_desc->parent->img_id] &
+	      IMG_FLAG_AUTHENTICATED) == 0U)) {
+		return 1;
+	}
+
+	for (i = 0 ; i < AUTH_METHOD_NUM ; i++) {
+		auth_method = &img_desc->img_auth_methods[i];
+		if (auth_method->type != AUTH_METHOD_HASH) {
+			continue;
+		}
+
+		if (auth_get_param(auth_method->param.hash.hash,
+				   img_desc->parent, &hash_der_ptr,
+				   &hash_der_len) != 0) {
+			return 1;
+		}
+
+		if (crypto_mod_verify_hash_start(hash_der_ptr,
+						 hash_der_len) != 0) {
+			return 1;
+		}
+
+		img_hash_stream.img_id = img_id;
+		img_hash_stream.len = 0U;
+		img_hash_stream.active = true;
+		return 0;
+	}
+
+	return 1;
+}
+
+/*
+ * Hash the next chunk of data of an image being loaded. If hashing fails, the
+ * image is hashed again when it is verified.
+ */
+void auth_mod_hash_update(unsigned int img_id, const void *data_ptr,
+			  unsigned int data_len)
+{
+	if (!img_hash_stream.active || (img_hash_stream.img_id != img_id)) {
+		return;
+	}
+
+	if ((crypto_mod_verify_hash_update(data_ptr, data_len) != 0) ||
+	    ((img_hash_stream.len + data_len) < img_hash_stream.len)) {
+		img_hash_stream_abort();
+		return;
+	}
+
+	img_hash_stream.len += data_len;
+}
+
+/*
+ * Discard the hash of an image whose loading failed
+ */
+void auth_mod_hash_cancel(void)
+{
+	img_hash_stream_abort();
+}
+
 /*
  * Initialize the different modules in the authentication framework
  */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -50,6 +50,12 @@ void crypto_mod_init(void)
 CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_AND_HASH_CALC
 	assert(crypto_lib_desc.verify_signature != NULL);
 	assert(crypto_lib_desc.verify_hash != NULL);
+	assert((crypto_lib_desc.verify_hash_start == NULL) ==
+	       (crypto_lib_desc.verify_hash_finish == NULL));
+	assert((crypto_lib_desc.verify_hash_start == NULL) ==
+	       (crypto_lib_desc.verify_hash_update == NULL));
+	assert((crypto_lib_desc.verify_hash_start == NULL) ==
+	       (crypto_lib_desc.verify_hash_abort == NULL));
 #endif /* CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_ONLY || \
 	  CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_AND_HASH_CALC */
 
@@ -115,6 +121,68 @@ int crypto_mod_verify_hash(void *data_ptr, unsigned int data_len,
 	return crypto_lib_desc.verify_hash(data_ptr, data_len,
 					   digest_info_ptr, digest_info_len);
 }
+
+/*
+ * Start verifying a hash over data provided in several chunks. Returns
+ * CRYPTO_ERR_INIT if the crypto library does not support it, in which case
+ * crypto_mod_verify_hash() must be used instead.
+ *
+ * Parameters:
+ *
+ *   digest_info_ptr, digest_info_len: hash to be compared
+ */
+int crypto_mod_verify_hash_start(void *digest_info_ptr,
+				 unsigned int digest_info_len)
+{
+	assert(digest_info_ptr != NULL);
+	assert(digest_info_len != 0);
+
+	if (crypto_lib_desc.verify_hash_start == NULL) {
+		return CRYPTO_ERR_INIT;
+	}
+
+	return crypto_lib_desc.verify_hash_start(digest_info_ptr,
+						 digest_info_len);
+}
+
+/*
+ * Hash the next chunk of data of a verification started with
+ * crypto_mod_verify_hash_start()
+ *
+ * Parameters:
+ *
+ *   data_ptr, data_len: data to be hashed
+ */
+int crypto_mod_verify_hash_update(const void *data_ptr, unsigned int data_len)
+{
+	assert(crypto_lib_desc.verify_hash_update != NULL);
+	assert(data_ptr != NULL);
+	assert(data_len != 0);
+
+	return crypto_lib_desc.verify_hash_update(data_ptr, data_len);
+}
+
+/*
+ * Complete a verification started with crypto_mod_verify_hash_start() by
+ * comparing the hash of all the data provided against the expected one
+ */
+int crypto_mod_verify_hash_finish(void)
+{
+	assert(crypto_lib_desc.verify_hash_finish != NULL);
+
+	return crypto_lib_desc.verify_hash_finish();
+}
+
+/*
+ * Abandon a verification started with crypto_mod_verify_hash_start() and not
+ * completed with crypto_mod_verify_hash_finish()
+ */
+void crypto_mod_verify_hash_abort(void)
+{
+	assert(crypto_lib_desc.verify_hash_abort != NULL);
+
+	crypto_lib_desc.verify_hash_abort();
+}
 #endif /* CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_ONLY || \
 	  CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_AND_HASH_CALC */
 
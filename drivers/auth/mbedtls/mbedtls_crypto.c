@@ -1,10 +1,11 @@
 /*
- * Copyright (c) 2015-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <assert.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <string.h>
 
@@ -20,6 +21,9 @@
 #include <common/debug.h>
 #include <drivers/auth/crypto_mod.h>
 #include <drivers/auth/mbedtls/mbedtls_common.h>
+#if TF_MBEDTLS_SHA2_CE
+#include <drivers/auth/sha2_ce.h>
+#endif
 
 #include <plat/common/platform.h>
 
@@ -63,6 +67,50 @@ static void init(void)
 	mbedtls_init();
 }
 
+#if TF_MBEDTLS_SHA2_CE
+/*
+ * Check whether a hash can be computed with the SHA-2 instructions rather than
+ * by mbed TLS, and return the corresponding generic algorithm.
+ */
+static bool sha2_ce_md_algo(const mbedtls_md_info_t *md_info,
+			    enum crypto_md_algo *algo)
+{
+	switch (mbedtls_md_get_type(md_info)) {
+	case MBEDTLS_MD_SHA256:
+		*algo = CRYPTO_MD_SHA256;
+		break;
+	case MBEDTLS_MD_SHA384:
+		*algo = CRYPTO_MD_SHA384;
+		break;
+	case MBEDTLS_MD_SHA512:
+		*algo = CRYPTO_MD_SHA512;
+		break;
+	default:
+		return false;
+	}
+
+	return sha2_ce_supported(*algo);
+}
+#endif /* TF_MBEDTLS_SHA2_CE */
+
+/*
+ * Calculate the hash of a buffer, with the SHA-2 instructions if possible.
+ */
+static int md_calc(const mbedtls_md_info_t *md_info,
+		   const unsigned char *data, size_t data_len,
+		   unsigned char *output)
+{
+#if TF_MBEDTLS_SHA2_CE
+	enum crypto_md_algo algo;
+
+	if (sha2_ce_md_algo(md_info, &algo)) {
+		sha2_ce_calc(algo, data, data_len, output);
+		return 0;
+	}
+#endif
+	return mbedtls_md(md_info, data, data_len, output);
+}
+
 #if CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_ONLY || \
 CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_AND_HASH_CALC
 
@@ -141,7 +189,7 @@ static int verify_signature(void *data_ptr, unsigned int data_len,
 		goto end1;
 	}
 	p = (unsigned char *)data_ptr;
-	rc = mbedtls_md(md_info, p, data_len, hash);
+	rc = md_calc(md_info, p, data_len, hash);
 	if (rc != 0) {
 		rc = CRYPTO_ERR_SIGNATURE;
 		goto end1;
@@ -167,19 +215,19 @@ end2:
 }
 
 /*
- * Match a hash
+ * Parse a hash
  *
  * Digest info is passed in DER format following the ASN.1 structure detailed
- * above.
+ * above. On success, 'md_info' describes the hash algorithm and 'hash' points
+ * to the hash value within the digest info.
  */
-static int verify_hash(void *data_ptr, unsigned int data_len,
-		       void *digest_info_ptr, unsigned int digest_info_len)
+static int get_digest_info(void *digest_info_ptr, unsigned int digest_info_len,
+			   const mbedtls_md_info_t **md_info,
+			   unsigned char **hash)
 {
 	mbedtls_asn1_buf hash_oid, params;
 	mbedtls_md_type_t md_alg;
-	const mbedtls_md_info_t *md_info;
-	unsigned char *p, *end, *hash;
-	unsigned char data_hash[MBEDTLS_MD_MAX_SIZE];
+	unsigned char *p, *end;
 	size_t len;
 	int rc;
 
@@ -209,8 +257,8 @@ static int verify_hash(void *data_ptr, unsigned int data_len,
 		return CRYPTO_ERR_HASH;
 	}
 
-	md_info = mbedtls_md_info_from_type(md_alg);
-	if (md_info == NULL) {
+	*md_info = mbedtls_md_info_from_type(md_alg);
+	if (*md_info == NULL) {
 		return CRYPTO_ERR_HASH;
 	}
 
@@ -221,14 +269,35 @@ static int verify_hash(void *data_ptr, unsigned int data_len,
 	}
 
 	/* Length of hash must match the algorithm's size */
-	if (len != mbedtls_md_get_size(md_info)) {
+	if (len != mbedtls_md_get_size(*md_info)) {
 		return CRYPTO_ERR_HASH;
 	}
-	hash = p;
+	*hash = p;
+
+	return CRYPTO_SUCCESS;
+}
+
+/*
+ * Match a hash
+ *
+ * Digest info is passed in DER format following the ASN.1 structure detailed
+ * above.
+ */
+static int verify_hash(void *data_ptr, unsigned int data_len,
+		       void *digest_info_ptr, unsigned int digest_info_len)
+{
+	const mbedtls_md_info_t *md_info;
+	unsigned char *hash;
+	unsigned char data_hash[MBEDTLS_MD_MAX_SIZE];
+	int rc;
+
+	rc = get_digest_info(digest_info_ptr, digest_info_len, &md_info, &hash);
+	if (rc != CRYPTO_SUCCESS) {
+		return rc;
+	}
 
 	/* Calculate the hash of the data */
-	p = (unsigned char *)data_ptr;
-	rc = mbedtls_md(md_info, p, data_len, data_hash);
+	rc = md_calc(md_info, (unsigned char *)data_ptr, data_len, data_hash);
 	if (rc != 0) {
 		return CRYPTO_ERR_HASH;
 	}
@@ -241,6 +310,142 @@ static int verify_hash(void *data_ptr, unsigned int data_len,
 
 	return CRYPTO_SUCCESS;
 }
+
+/*
+ * State of the hash verification over data provided in several chunks. The
+ * expected hash is copied as the digest info may not outlive the verification.
+ */
+static struct {
+	mbedtls_md_context_t ctx;
+#if TF_MBEDTLS_SHA2_CE
+	sha2_ce_ctx_t ce_ctx;
+	bool use_ce;
+#endif
+	unsigned char hash[MBEDTLS_MD_MAX_SIZE];
+	size_t hash_len;
+	bool active;
+} hash_stream;
+
+/*
+ * Release the resources of a hash verification over data provided in several
+ * chunks, whether it has completed or not
+ */
+static void verify_hash_abort(void)
+{
+	if (hash_stream.active) {
+		mbedtls_md_free(&hash_stream.ctx);
+		hash_stream.active = false;
+	}
+#if TF_MBEDTLS_SHA2_CE
+	hash_stream.use_ce = false;
+#endif
+}
+
+/*
+ * Start matching a hash over data provided in several chunks
+ */
+static int verify_hash_start(void *digest_info_ptr,
+			     unsigned int digest_info_len)
+{
+	const mbedtls_md_info_t *md_info;
+	unsigned char *hash;
+#if TF_MBEDTLS_SHA2_CE
+	enum crypto_md_algo algo;
+#endif
+	int rc;
+
+	verify_hash_abort();
+
+	rc = get_digest_info(digest_info_ptr, digest_info_len, &md_info, &hash);
+	if (rc != CRYPTO_SUCCESS) {
+		return rc;
+	}
+
+	hash_stream.hash_len = mbedtls_md_get_size(md_info);
+
+#if TF_MBEDTLS_SHA2_CE
+	if (sha2_ce_md_algo(md_info, &algo)) {
+		sha2_ce_start(&hash_stream.ce_ctx, algo);
+		hash_stream.use_ce = true;
+		(void)memcpy(hash_stream.hash, hash, hash_stream.hash_len);
+		return CRYPTO_SUCCESS;
+	}
+#endif
+
+	mbedtls_md_init(&hash_stream.ctx);
+	hash_stream.active = true;
+
+	rc = mbedtls_md_setup(&hash_stream.ctx, md_info, 0);
+	if (rc == 0) {
+		rc = mbedtls_md_starts(&hash_stream.ctx);
+	}
+	if (rc != 0) {
+		verify_hash_abort();
+		return CRYPTO_ERR_HASH;
+	}
+
+	(void)memcpy(hash_stream.hash, hash, hash_stream.hash_len);
+
+	return CRYPTO_SUCCESS;
+}
+
+static int verify_hash_update(const void *data_ptr, unsigned int data_len)
+{
+	int rc;
+
+#if TF_MBEDTLS_SHA2_CE
+	if (hash_stream.use_ce) {
+		sha2_ce_update(&hash_stream.ce_ctx, data_ptr, data_len);
+		return CRYPTO_SUCCESS;
+	}
+#endif
+
+	if (!hash_stream.active) {
+		return CRYPTO_ERR_HASH;
+	}
+
+	rc = mbedtls_md_update(&hash_stream.ctx, data_ptr, data_len);
+	if (rc != 0) {
+		verify_hash_abort();
+		return CRYPTO_ERR_HASH;
+	}
+
+	return CRYPTO_SUCCESS;
+}
+
+static int verify_hash_finish(void)
+{
+	unsigned char data_hash[MBEDTLS_MD_MAX_SIZE];
+	int rc;
+
+#if TF_MBEDTLS_SHA2_CE
+	if (hash_stream.use_ce) {
+		sha2_ce_finish(&hash_stream.ce_ctx, data_hash);
+		hash_stream.use_ce = false;
+		rc = memcmp(data_hash, hash_stream.hash, hash_stream.hash_len);
+
+		return (rc == 0) ? CRYPTO_SUCCESS : CRYPTO_ERR_HASH;
+	}
+#endif
+
+	if (!hash_stream.active) {
+		return CRYPTO_ERR_HASH;
+	}
+
+	rc = mbedtls_md_finish(&hash_stream.ctx, data_hash);
+	verify_hash_abort();
+	if (rc != 0) {
+		return CRYPTO_ERR_HASH;
+	}
+
+	/* Compare values */
+	rc = memcmp(data_hash, hash_stream.hash, hash_stream.hash_len);
+	if (rc != 0) {
+		return CRYPTO_ERR_HASH;
+	}
+
+	return CRYPTO_SUCCESS;
+}
 #endif /* CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_ONLY || \
 	  CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_AND_HASH_CALC */
 
@@ -286,7 +491,7 @@ static int calc_hash(enum crypto_md_algo md_algo, void *data_ptr,
 	 * 'output' hash buffer pointer considering its size is always
 	 * bigger than or equal to MBEDTLS_MD_MAX_SIZE.
 	 */
-	return mbedtls_md(md_info, data_ptr, data_len, output);
+	return md_calc(md_info, data_ptr, data_len, output);
 }
 #endif /* CRYPTO_SUPPORT == CRYPTO_HASH_CALC_ONLY || \
 	  CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_AND_HASH_CALC */
@@ -410,19 +615,27 @@ static int auth_decrypt(enum crypto_dec_algo dec_algo, void *data_ptr,
  */
 #if CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_AND_HASH_CALC
 #if TF_MBEDTLS_USE_AES_GCM
-REGISTER_CRYPTO_LIB(LIB_NAME, init, verify_signature, verify_hash, calc_hash,
-		    auth_decrypt, NULL);
+REGISTER_CRYPTO_LIB_HASH_STREAM(LIB_NAME, init, verify_signature, verify_hash,
+				calc_hash, auth_decrypt, NULL,
+				verify_hash_start, verify_hash_update,
+				verify_hash_finish, verify_hash_abort);
 #else
-REGISTER_CRYPTO_LIB(LIB_NAME, init, verify_signature, verify_hash, calc_hash,
-		    NULL, NULL);
+REGISTER_CRYPTO_LIB_HASH_STREAM(LIB_NAME, init, verify_signature, verify_hash,
+				calc_hash, NULL, NULL,
+				verify_hash_start, verify_hash_update,
+				verify_hash_finish, verify_hash_abort);
 #endif
 #elif CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_ONLY
 #if TF_MBEDTLS_USE_AES_GCM
-REGISTER_CRYPTO_LIB(LIB_NAME, init, verify_signature, verify_hash, NULL,
-		    auth_decrypt, NULL);
+REGISTER_CRYPTO_LIB_HASH_STREAM(LIB_NAME, init, verify_signature, verify_hash,
+				NULL, auth_decrypt, NULL,
+				verify_hash_start, verify_hash_update,
+				verify_hash_finish, verify_hash_abort);
 #else
-REGISTER_CRYPTO_LIB(LIB_NAME, init, verify_signature, verify_hash, NULL,
-		    NULL, NULL);
+REGISTER_CRYPTO_LIB_HASH_STREAM(LIB_NAME, init, verify_signature, verify_hash,
+				NULL, NULL, NULL,
+				verify_hash_start, verify_hash_update,
+				verify_hash_finish, verify_hash_abort);
 #endif
 #elif CRYPTO_SUPPORT == CRYPTO_HASH_CALC_ONLY
 REGISTER_CRYPTO_LIB(LIB_NAME, init, NULL, NULL, calc_hash, NULL, NULL);
@@ -1,5 +1,5 @@
 #
-# Copyright (c) 2015-2023, Arm Limited and Contributors. All rights reserved.
+# Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
 #
 # SPDX-License-Identifier: BSD-3-Clause
 #
@@ -13,4 +13,16 @@ ifeq (${PSA_CRYPTO},1)
 	MBEDTLS_SOURCES +=	drivers/auth/mbedtls/mbedtls_psa_crypto.c
 else
 	MBEDTLS_SOURCES +=	drivers/auth/mbedtls/mbedtls_crypto.c
+
+	# Hash calculations use the SHA-2 instructions when available, mbed TLS
+	# remains used for the other algorithms.
+	TF_MBEDTLS_SHA2_CE	:=	0
+	ifeq (${ARCH},aarch64)
+		ifneq ($(filter-out 0,${ENABLE_FEAT_SHA256} ${ENABLE_FEAT_SHA512}),)
+			TF_MBEDTLS_SHA2_CE	:=	1
+			MBEDTLS_SOURCES	+=	drivers/auth/sha2_ce/sha2_ce.c	\
+					drivers/auth/sha2_ce/aarch64/sha2_ce_core.S
+		endif
+	endif
+	$(eval $(call add_define,TF_MBEDTLS_SHA2_CE))
 endif
@@ -1,10 +1,11 @@
 /*
- * Copyright (c) 2023-2024, Arm Limited. All rights reserved.
+ * Copyright (c) 2023-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <assert.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <string.h>
 
@@ -289,21 +290,21 @@ end2:
 }
 
 /*
- * Match a hash
+ * Parse a hash
  *
  * Digest info is passed in DER format following the ASN.1 structure detailed
- * above.
+ * above. On success, 'psa_md_alg' is the hash algorithm and 'hash', 'hash_len'
+ * the hash value within the digest info.
  */
-static int verify_hash(void *data_ptr, unsigned int data_len,
-		       void *digest_info_ptr, unsigned int digest_info_len)
+static int get_digest_info(void *digest_info_ptr, unsigned int digest_info_len,
+			   psa_algorithm_t *psa_md_alg, unsigned char **hash,
+			   size_t *hash_len)
 {
 	mbedtls_asn1_buf hash_oid, params;
 	mbedtls_md_type_t md_alg;
-	unsigned char *p, *end, *hash;
+	unsigned char *p, *end;
 	size_t len;
 	int rc;
-	psa_status_t status;
-	psa_algorithm_t psa_md_alg;
 
 	/*
 	 * Digest info should be an MBEDTLS_ASN1_SEQUENCE, but padding after
@@ -331,7 +332,6 @@ static int verify_hash(void *data_ptr, unsigned int data_len,
 	if ((rc != 0) || ((size_t)(end - p) != len)) {
 		return CRYPTO_ERR_HASH;
 	}
-	hash = p;
 
 	rc = mbedtls_oid_get_md_alg(&hash_oid, &md_alg);
 	if (rc != 0) {
@@ -339,13 +339,40 @@ static int verify_hash(void *data_ptr, unsigned int data_len,
 	}
 
 	/* convert the md_alg to psa_algo */
-	psa_md_alg = mbedtls_md_psa_alg_from_type(md_alg);
+	*psa_md_alg = mbedtls_md_psa_alg_from_type(md_alg);
 
 	/* Length of hash must match the algorithm's size */
-	if (len != PSA_HASH_LENGTH(psa_md_alg)) {
+	if (len != PSA_HASH_LENGTH(*psa_md_alg)) {
 		return CRYPTO_ERR_HASH;
 	}
 
+	*hash = p;
+	*hash_len = len;
+
+	return CRYPTO_SUCCESS;
+}
+
+/*
+ * Match a hash
+ *
+ * Digest info is passed in DER format following the ASN.1 structure detailed
+ * above.
+ */
+static int verify_hash(void *data_ptr, unsigned int data_len,
+		       void *digest_info_ptr, unsigned int digest_info_len)
+{
+	unsigned char *hash;
+	size_t len;
+	int rc;
+	psa_status_t status;
+	psa_algorithm_t psa_md_alg;
+
+	rc = get_digest_info(digest_info_ptr, digest_info_len, &psa_md_alg,
+			     &hash, &len);
+	if (rc != CRYPTO_SUCCESS) {
+		return rc;
+	}
+
 	/*
 	 * Calculate Hash and compare it against the retrieved hash from
 	 * the certificate (one shot API).
@@ -360,6 +387,101 @@ static int verify_hash(void *data_ptr, unsigned int data_len,
 
 	return CRYPTO_SUCCESS;
 }
+
+/*
+ * State of the hash verification over data provided in several chunks. The
+ * expected hash is copied as the digest info may not outlive the verification.
+ */
+static struct {
+	psa_hash_operation_t operation;
+	uint8_t hash[PSA_HASH_MAX_SIZE];
+	size_t hash_len;
+	bool active;
+} hash_stream;
+
+/*
+ * Release the resources of a hash verification over data provided in several
+ * chunks, whether it has completed or not
+ */
+static void verify_hash_abort(void)
+{
+	if (hash_stream.active) {
+		(void)psa_hash_abort(&hash_stream.operation);
+		hash_stream.active = false;
+	}
+}
+
+/*
+ * Start matching a hash over data provided in several chunks
+ */
+static int verify_hash_start(void *digest_info_ptr,
+			     unsigned int digest_info_len)
+{
+	unsigned char *hash;
+	size_t len;
+	int rc;
+	psa_status_t status;
+	psa_algorithm_t psa_md_alg;
+
+	verify_hash_abort();
+
+	rc = get_digest_info(digest_info_ptr, digest_info_len, &psa_md_alg,
+			     &hash, &len);
+	if (rc != CRYPTO_SUCCESS) {
+		return rc;
+	}
+
+	hash_stream.operation = psa_hash_operation_init();
+	hash_stream.active = true;
+
+	status = psa_hash_setup(&hash_stream.operation, psa_md_alg);
+	if (status != PSA_SUCCESS) {
+		verify_hash_abort();
+		return CRYPTO_ERR_HASH;
+	}
+
+	(void)memcpy(hash_stream.hash, hash, len);
+	hash_stream.hash_len = len;
+
+	return CRYPTO_SUCCESS;
+}
+
+static int verify_hash_update(const void *data_ptr, unsigned int data_len)
+{
+	psa_status_t status;
+
+	if (!hash_stream.active) {
+		return CRYPTO_ERR_HASH;
+	}
+
+	status = psa_hash_update(&hash_stream.operation, data_ptr,
+				 (size_t)data_len);
+	if (status != PSA_SUCCESS) {
+		verify_hash_abort();
+		return CRYPTO_ERR_HASH;
+	}
+
+	return CRYPTO_SUCCESS;
+}
+
+static int verify_hash_finish(void)
+{
+	psa_status_t status;
+
+	if (!hash_stream.active) {
+		return CRYPTO_ERR_HASH;
+	}
+
+	/* The operation must be aborted if the verification fails */
+	status = psa_hash_verify(&hash_stream.operation, hash_stream.hash,
+				 hash_stream.hash_len);
+	verify_hash_abort();
+	if (status != PSA_SUCCESS) {
+		return CRYPTO_ERR_HASH;
+	}
+
+	return CRYPTO_SUCCESS;
+}
 #endif /*
 	* CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_ONLY || \
 	* CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_AND_HASH_CALC
@@ -540,19 +662,27 @@ static int auth_decrypt(enum crypto_dec_algo dec_algo, void *data_ptr,
  */
 #if CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_AND_HASH_CALC
 #if TF_MBEDTLS_USE_AES_GCM
-REGISTER_CRYPTO_LIB(LIB_NAME, init, verify_signature, verify_hash, calc_hash,
-		    auth_decrypt, NULL);
+REGISTER_CRYPTO_LIB_HASH_STREAM(LIB_NAME, init, verify_signature, verify_hash,
+				calc_hash, auth_decrypt, NULL,
+				verify_hash_start, verify_hash_update,
+				verify_hash_finish, verify_hash_abort);
 #else
-REGISTER_CRYPTO_LIB(LIB_NAME, init, verify_signature, verify_hash, calc_hash,
-		    NULL, NULL);
+REGISTER_CRYPTO_LIB_HASH_STREAM(LIB_NAME, init, verify_signature, verify_hash,
+				calc_hash, NULL, NULL,
+				verify_hash_start, verify_hash_update,
+				verify_hash_finish, verify_hash_abort);
 #endif
 #elif CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_ONLY
 #if TF_MBEDTLS_USE_AES_GCM
-REGISTER_CRYPTO_LIB(LIB_NAME, init, verify_signature, verify_hash, NULL,
-		    auth_decrypt, NULL);
+REGISTER_CRYPTO_LIB_HASH_STREAM(LIB_NAME, init, verify_signature, verify_hash,
+				NULL, auth_decrypt, NULL,
+				verify_hash_start, verify_hash_update,
+				verify_hash_finish, verify_hash_abort);
 #else
-REGISTER_CRYPTO_LIB(LIB_NAME, init, verify_signature, verify_hash, NULL,
-		    NULL, NULL);
+REGISTER_CRYPTO_LIB_HASH_STREAM(LIB_NAME, init, verify_signature, verify_hash,
+				NULL, NULL, NULL,
+				verify_hash_start, verify_hash_update,
+				verify_hash_finish, verify_hash_abort);
 #endif
 #elif CRYPTO_SUPPORT == CRYPTO_HASH_CALC_ONLY
 REGISTER_CRYPTO_LIB(LIB_NAME, init, NULL, NULL, calc_hash, NULL, NULL);
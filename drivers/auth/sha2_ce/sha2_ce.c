@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include <arch.h>
+#include <arch_features.h>
+#include <arch_helpers.h>
+#include <drivers/auth/sha2_ce.h>
+#include <lib/utils_def.h>
+
+#define SHA256_BLOCK_SIZE	64U
+#define SHA512_BLOCK_SIZE	128U
+
+void sha256_ce_transform(uint32_t state[8], const uint8_t *data,
+			 size_t blocks);
+void sha512_ce_transform(uint64_t state[8], const uint8_t *data,
+			 size_t blocks);
+
+static const uint32_t sha256_iv[8] = {
+	0x6a09e667U, 0xbb67ae85U, 0x3c6ef372U, 0xa54ff53aU,
+	0x510e527fU, 0x9b05688cU, 0x1f83d9abU, 0x5be0cd19U,
+};
+
+static const uint64_t sha384_iv[8] = {
+	0xcbbb9d5dc1059ed8ULL, 0x629a292a367cd507ULL,
+	0x9159015a3070dd17ULL, 0x152fecd8f70e5939ULL,
+	0x67332667ffc00b31ULL, 0x8eb44a8768581511ULL,
+	0xdb0c2e0d64f98fa7ULL, 0x47b5481dbefa4fa4ULL,
+};
+
+static const uint64_t sha512_iv[8] = {
+	0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL,
+	0x3c6ef372fe94f82bULL, 0xa54ff53a5f1d36f1ULL,
+	0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL,
+	0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL,
+};
+
+/*
+ * The instructions use the SIMD registers. They are only used in BL1 and BL2,
+ * which run before any lower EL state has been set up in these registers.
+ */
+bool sha2_ce_supported(enum crypto_md_algo algo)
+{
+#if defined(IMAGE_BL1) || defined(IMAGE_BL2)
+	switch (algo) {
+	case CRYPTO_MD_SHA256:
+		return is_feat_sha256_supported();
+	case CRYPTO_MD_SHA384:
+	case CRYPTO_MD_SHA512:
+		return is_feat_sha512_supported();
+	default:
+		return false;
+	}
+#else
+	(void)algo;
+
+	return false;
+#endif
+}
+
+unsigned int sha2_ce_size(enum crypto_md_algo algo)
+{
+	switch (algo) {
+	case CRYPTO_MD_SHA256:
+		return 32U;
+	case CRYPTO_MD_SHA384:
+		return 48U;
+	default:
+		return 64U;
+	}
+}
+
+static size_t block_size(const sha2_ce_ctx_t *ctx)
+{
+	return (ctx->algo == CRYPTO_MD_SHA256) ? SHA256_BLOCK_SIZE :
+		SHA512_BLOCK_SIZE;
+}
+
+/*
+ * FP/SIMD accesses are trapped at EL3 until the context of a lower EL is set
+ * up, let them through while the blocks are processed.
+ */
+static void sha2_ce_transform(sha2_ce_ctx_t *ctx, const uint8_t *data,
+			      size_t blocks)
+{
+	u_register_t cptr_el3 = 0U;
+	bool el3 = IS_IN_EL3();
+
+	if (el3) {
+		cptr_el3 = read_cptr_el3();
+		write_cptr_el3(cptr_el3 & ~TFP_BIT);
+		isb();
+	}
+
+	if (ctx->algo == CRYPTO_MD_SHA256) {
+		sha256_ce_transform(ctx->state.s256, data, blocks);
+	} else {
+		sha512_ce_transform(ctx->state.s512, data, blocks);
+	}
+
+	if (el3) {
+		write_cptr_el3(cptr_el3);
+		isb();
+	}
+}
+
+void sha2_ce_start(sha2_ce_ctx_t *ctx, enum crypto_md_algo algo)
+{
+	assert(sha2_ce_supported(algo));
+
+	ctx->algo = algo;
+	ctx->buf_len = 0U;
+	ctx->total_len = 0U;
+
+	switch (algo) {
+	case CRYPTO_MD_SHA256:
+		(void)memcpy(ctx->state.s256, sha256_iv, sizeof(sha256_iv));
+		break;
+	case CRYPTO_MD_SHA384:
+		(void)memcpy(ctx->state.s512, sha384_iv, sizeof(sha384_iv));
+		break;
+	default:
+		(void)memcpy(ctx->state.s512, sha512_iv, sizeof(sha512_iv));
+		break;
+	}
+}
+
+void sha2_ce_update(sha2_ce_ctx_t *ctx, const void *data, size_t len)
+{
+	const uint8_t *p = data;
+	size_t bs = block_size(ctx);
+	size_t n;
+
+	ctx->total_len += len;
+
+	/* Complete a pending partial block first */
+	if (ctx->buf_len != 0U) {
+		n = MIN(len, bs - ctx->buf_len);
+		(void)memcpy(&ctx->buf[ctx->buf_len], p, n);
+		ctx->buf_len += n;
+		p += n;
+		len -= n;
+
+		if (ctx->buf_len < bs) {
+			return;
+		}
+
+		sha2_ce_transform(ctx, ctx->buf, 1U);
+		ctx->buf_len = 0U;
+	}
+
+	/* Whole blocks are processed in place */
+	n = len / bs;
+	if (n != 0U) {
+		sha2_ce_transform(ctx, p, n);
+		p += n * bs;
+		len -= n * bs;
+	}
+
+	if (len != 0U) {
+		(void)memcpy(ctx->buf, p, len);
+		ctx->buf_len = len;
+	}
+}
+
+void sha2_ce_finish(sha2_ce_ctx_t *ctx, uint8_t *output)
+{
+	size_t bs = block_size(ctx);
+	/* Length field: 64 bits for SHA-256, 128 bits for SHA-384/512 */
+	size_t len_size = bs / 8U;
+	uint64_t bits = ctx->total_len * 8U;
+	unsigned int size = sha2_ce_size(ctx->algo);
+	unsigned int i;
+
+	ctx->buf[ctx->buf_len++] = 0x80U;
+	if (ctx->buf_len > (bs - len_size)) {
+		(void)memset(&ctx->buf[ctx->buf_len], 0, bs - ctx->buf_len);
+		sha2_ce_transform(ctx, ctx->buf, 1U);
+		ctx->buf_len = 0U;
+	}
+
+	(void)memset(&ctx->buf[ctx->buf_len], 0, bs - ctx->buf_len);
+	for (i = 0U; i < 8U; i++) {
+		ctx->buf[bs - 1U - i] = (uint8_t)(bits >> (8U * i));
+	}
+	sha2_ce_transform(ctx, ctx->buf, 1U);
+
+	/* The digest is the big-endian state, truncated for SHA-384 */
+	for (i = 0U; i < size; i++) {
+		if (ctx->algo == CRYPTO_MD_SHA256) {
+			output[i] = (uint8_t)(ctx->state.s256[i / 4U] >>
+					      (24U - (8U * (i % 4U))));
+		} else {
+			output[i] = (uint8_t)(ctx->state.s512[i / 8U] >>
+					      (56U - (8U * (i % 8U))));
+		}
+	}
+
+	(void)memset(ctx, 0, sizeof(*ctx));
+}
+
+void sha2_ce_calc(enum crypto_md_algo algo, const void *data, size_t len,
+		  uint8_t *output)
+{
+	sha2_ce_ctx_t ctx;
+
+	sha2_ce_start(&ctx, algo);
+	sha2_ce_update(&ctx, data, len);
+	sha2_ce_finish(&ctx, output);
+}
@@ -1,11 +1,12 @@
 /*
- * Copyright (c) 2016-2023, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2016-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <assert.h>
 #include <errno.h>
+#include <stdbool.h>
 #include <string.h>
 
 #include <platform_def.h>
@@ -25,6 +26,47 @@ typedef struct {
 
 #define is_power_of_2(x)	(((x) != 0U) && (((x) & ((x) - 1U)) == 0U))
 
+/*
+ * Optional cache of recently read blocks, shared by all block devices whose
+ * block size is IO_BLOCK_CACHE_BLOCK_SIZE. Small reads are served from it,
+ * large ones go straight to the device.
+ */
+#ifndef IO_BLOCK_CACHE_ENTRIES
+#define IO_BLOCK_CACHE_ENTRIES		0U
+#endif
+
+#ifndef IO_BLOCK_CACHE_BLOCK_SIZE
+#define IO_BLOCK_CACHE_BLOCK_SIZE	512U
+#endif
+
+/* Number of blocks read ahead when reads are sequential */
+#ifndef IO_BLOCK_CACHE_READ_AHEAD
+#define IO_BLOCK_CACHE_READ_AHEAD	8U
+#endif
+
+#if IO_BLOCK_CACHE_ENTRIES != 0
+typedef struct {
+	const io_block_dev_spec_t	*dev_spec;
+	int				lba;
+	unsigned int			last_use;
+} block_cache_entry_t;
+
+typedef struct {
+	block_cache_entry_t	entries[IO_BLOCK_CACHE_ENTRIES];
+	unsigned int		tick;
+	/* Device and block following the last read, to detect sequential reads */
+	const io_block_dev_spec_t *next_dev_spec;
+	int			next_lba;
+	unsigned int		hits;
+	unsigned int		misses;
+	unsigned int		read_ahead;
+} block_cache_t;
+
+static block_cache_t block_cache;
+static uint8_t block_cache_data[IO_BLOCK_CACHE_ENTRIES]
+			       [IO_BLOCK_CACHE_BLOCK_SIZE];
+#endif /* IO_BLOCK_CACHE_ENTRIES != 0 */
+
 io_type_t device_type_block(void);
 
 static int block_open(io_dev_info_t *dev_info, const uintptr_t spec,
@@ -124,6 +166,191 @@ static int free_dev_info(io_dev_info_t *dev_info)
 	return result;
 }
 
+#if IO_BLOCK_CACHE_ENTRIES != 0
+/* Locate the cache entry holding a block, NULL if the block isn't cached */
+static block_cache_entry_t *block_cache_find(const io_block_dev_spec_t *dev_spec,
+					     int lba)
+{
+	unsigned int index;
+
+	for (index = 0U; index < IO_BLOCK_CACHE_ENTRIES; ++index) {
+		if ((block_cache.entries[index].dev_spec == dev_spec) &&
+		    (block_cache.entries[index].lba == lba)) {
+			return &block_cache.entries[index];
+		}
+	}
+
+	return NULL;
+}
+
+/* Add a block to the cache, evicting the least recently used one */
+static void block_cache_insert(const io_block_dev_spec_t *dev_spec, int lba,
+			       uintptr_t data)
+{
+	block_cache_entry_t *entry;
+	unsigned int index, victim = 0U;
+
+	if (block_cache_find(dev_spec, lba) != NULL) {
+		return;
+	}
+
+	for (index = 0U; index < IO_BLOCK_CACHE_ENTRIES; ++index) {
+		entry = &block_cache.entries[index];
+		if (entry->dev_spec == NULL) {
+			victim = index;
+			break;
+		}
+		if (entry->last_use < block_cache.entries[victim].last_use) {
+			victim = index;
+		}
+	}
+
+	entry = &block_cache.entries[victim];
+	entry->dev_spec = dev_spec;
+	entry->lba = lba;
+	entry->last_use = ++block_cache.tick;
+	memcpy(block_cache_data[victim], (void *)data,
+	       IO_BLOCK_CACHE_BLOCK_SIZE);
+}
+
+/* Drop the cached copies of a range of blocks */
+static void block_cache_invalidate(const io_block_dev_spec_t *dev_spec,
+				   int lba, size_t count)
+{
+	block_cache_entry_t *entry;
+	unsigned int index;
+
+	for (index = 0U; index < IO_BLOCK_CACHE_ENTRIES; ++index) {
+		entry = &block_cache.entries[index];
+		if ((entry->dev_spec == dev_spec) && (entry->lba >= lba) &&
+		    ((size_t)(entry->lba - lba) < count)) {
+			entry->dev_spec = NULL;
+		}
+	}
+
+	block_cache.next_dev_spec = NULL;
+}
+
+static bool block_cache_usable(const io_block_dev_spec_t *dev_spec,
+			       size_t size)
+{
+	return (dev_spec->block_size == IO_BLOCK_CACHE_BLOCK_SIZE) &&
+	       ((size / IO_BLOCK_CACHE_BLOCK_SIZE) <=
+		(IO_BLOCK_CACHE_ENTRIES / 2U));
+}
+#endif /* IO_BLOCK_CACHE_ENTRIES != 0 */
+
+/*
+ * Read 'size' bytes from block 'lba' into 'buf', which can hold up to 'buf_len'
+ * bytes. Returns the number of bytes read, as the device read operation does.
+ *
+ * With the block cache, the blocks found in it are copied and the others read
+ * from the device in a single operation. When reads are sequential, the
+ * following blocks are read in the same operation, as far as 'buf' can hold
+ * them and the region extends, and kept in the cache.
+ */
+static size_t block_dev_read(block_dev_state_t *cur, int lba, uintptr_t buf,
+			     size_t size, size_t buf_len)
+{
+	const io_block_dev_spec_t *dev_spec = cur->dev_spec;
+#if IO_BLOCK_CACHE_ENTRIES != 0
+	block_cache_entry_t *entry;
+	size_t block_size = dev_spec->block_size;
+	size_t count = size / block_size;
+	size_t first = count, last = 0U, i, needed, request, nbytes;
+	unsigned long long end_lba;
+	bool sequential;
+
+	if (!block_cache_usable(dev_spec, size)) {
+		return dev_spec->ops.read(lba, buf, size);
+	}
+
+	sequential = (block_cache.next_dev_spec == dev_spec) &&
+		     (block_cache.next_lba == lba);
+	block_cache.next_dev_spec = dev_spec;
+	block_cache.next_lba = lba + (int)count;
+
+	for (i = 0U; i < count; i++) {
+		entry = block_cache_find(dev_spec, lba + (int)i);
+		if (entry != NULL) {
+			entry->last_use = ++block_cache.tick;
+			memcpy((void *)(buf + (i * block_size)),
+			       block_cache_data[entry - block_cache.entries],
+			       block_size);
+			block_cache.hits++;
+		} else {
+			if (first == count) {
+				first = i;
+			}
+			last = i;
+			block_cache.misses++;
+		}
+	}
+
+	if (first == count) {
+		return size;
+	}
+
+	needed = (last + 1U - first) * block_size;
+	request = needed;
+	if (sequential) {
+		/* Never read ahead past the end of the region */
+		end_lba = (cur->base + cur->size) / block_size;
+		request = (count - first + IO_BLOCK_CACHE_READ_AHEAD) *
+			  block_size;
+		request = MIN(request, (buf_len & ~(block_size - 1U)) -
+				       (first * block_size));
+		request = MIN((unsigned long long)request,
+			      (end_lba - (unsigned long long)(lba + (int)first)) *
+			      block_size);
+		request = MAX(request, needed);
+	}
+
+	nbytes = dev_spec->ops.read(lba + (int)first,
+				    buf + (first * block_size), request);
+	if ((nbytes < needed) && (request > needed)) {
+		/*
+		 * The read-ahead may go past the last block of the device when
+		 * the region does not end with it, so retry without it.
+		 */
+		nbytes = dev_spec->ops.read(lba + (int)first,
+					    buf + (first * block_size), needed);
+	}
+	nbytes &= ~(block_size - 1U);
+
+	for (i = 0U; i < (nbytes / block_size); i++) {
+		block_cache_insert(dev_spec, lba + (int)(first + i),
+				   buf + ((first + i) * block_size));
+	}
+
+	if ((first * block_size) + nbytes > size) {
+		block_cache.read_ahead += (unsigned int)
+			((((first * block_size) + nbytes) - size) / block_size);
+	} else if ((first * block_size) + nbytes < size) {
+		return (first * block_size) + nbytes;
+	}
+
+	return size;
+#else
+	(void)buf_len;
+
+	return dev_spec->ops.read(lba, buf, size);
+#endif /* IO_BLOCK_CACHE_ENTRIES != 0 */
+}
+
+/* Write 'size' bytes from 'buf' to block 'lba', dropping any cached copy */
+static size_t block_dev_write(block_dev_state_t *cur, int lba, uintptr_t buf,
+			      size_t size)
+{
+	const io_block_dev_spec_t *dev_spec = cur->dev_spec;
+
+#if IO_BLOCK_CACHE_ENTRIES != 0
+	block_cache_invalidate(dev_spec, lba, size / dev_spec->block_size);
+#endif
+
+	return dev_spec->ops.write(lba, buf, size);
+}
+
 static int block_open(io_dev_info_t *dev_info, const uintptr_t spec,
 		      io_entity_t *entity)
 {
@@ -171,6 +398,21 @@ static int block_seek(io_entity_t *entity, int mode, signed long long offset)
 	return 0;
 }
 
+/*
+ * Whole blocks can be transferred straight between the device and the caller's
+ * buffer if the device allows it, and if the caller's buffer is aligned like
+ * the position on the device, so that each block boundary of the device falls
+ * on a block boundary of the caller's buffer.
+ */
+static bool block_direct_io(const block_dev_state_t *cur, uintptr_t buffer)
+{
+	size_t block_size = cur->dev_spec->block_size;
+
+	return cur->dev_spec->direct_io &&
+	       (((buffer - (uintptr_t)(cur->base + cur->file_pos)) &
+		 (block_size - 1U)) == 0U);
+}
+
 /*
  * This function allows the caller to read any number of bytes
  * from any position. It hides from the caller that the low level
@@ -240,13 +482,17 @@ static int block_seek(io_entity_t *entity, int mode, signed long long offset)
  *
  * Additionally, the IO driver has an underlying buffer that is at least
  * one block-size and may be big enough to allow.
+ *
+ * If the device allows it and the caller's buffer is suitably aligned, only
+ * the partial blocks at the start and the end of the span go through that
+ * buffer, the whole blocks in between are read straight into the caller's
+ * buffer.
  */
 static int block_read(io_entity_t *entity, uintptr_t buffer, size_t length,
 		      size_t *length_read)
 {
 	block_dev_state_t *cur;
 	io_block_spec_t *buf;
-	io_block_ops_t *ops;
 	int lba;
 	size_t block_size, left;
 	size_t nbytes;  /* number of bytes read in one iteration */
@@ -263,15 +509,17 @@ static int block_read(io_entity_t *entity, uintptr_t buffer, size_t length,
 	 * to be read and the end of the block
 	 */
 	size_t padding;
+	bool direct;
 
 	assert(entity->info != (uintptr_t)NULL);
 	cur = (block_dev_state_t *)entity->info;
-	ops = &(cur->dev_spec->ops);
 	buf = &(cur->dev_spec->buffer);
 	block_size = cur->dev_spec->block_size;
 	assert((length <= cur->size) &&
 	       (length > 0U) &&
-	       (ops->read != NULL));
+	       (cur->dev_spec->ops.read != NULL));
+
+	direct = block_direct_io(cur, buffer);
 
 	/*
 	 * We don't know the number of bytes that we are going
@@ -296,7 +544,28 @@ static int block_read(io_entity_t *entity, uintptr_t buffer, size_t length,
 		 */
 		lba = (cur->file_pos + cur->base) / block_size;
 
-		if ((skip + left) > buf->length) {
+		if (direct && (skip == 0U) && (left >= block_size)) {
+			/* Read the whole blocks straight to the caller */
+			request = left & ~(block_size - 1U);
+			nbytes = block_dev_read(cur, lba, buffer + count,
+						request, request);
+			nbytes &= ~(block_size - 1U);
+			if (nbytes == 0U) {
+				return -EIO;
+			}
+
+			cur->file_pos += nbytes;
+			count += nbytes;
+			continue;
+		}
+
+		if (direct && ((skip + left) > block_size)) {
+			/*
+			 * Only bounce the partial block at the start, the
+			 * following ones are read straight to the caller.
+			 */
+			request = block_size;
+		} else if ((skip + left) > buf->length) {
 			/*
 			 * The underlying read buffer is too small to
 			 * read all the required data - limit to just
@@ -314,7 +583,8 @@ static int block_read(io_entity_t *entity, uintptr_t buffer, size_t length,
 			request = (request + (block_size - 1U)) &
 				~(block_size - 1U);
 		}
-		request = ops->read(lba, buf->offset, request);
+		request = block_dev_read(cur, lba, buf->offset, request,
+					 buf->length);
 
 		if (request <= skip) {
 			/*
@@ -351,14 +621,14 @@ static int block_read(io_entity_t *entity, uintptr_t buffer, size_t length,
  * This function allows the caller to write any number of bytes
  * from any position. It hides from the caller that the low level
  * driver only can write aligned blocks of data.
- * See comments for block_read for more details.
+ * See comments for block_read for more details, whole blocks are also written
+ * straight from the caller's buffer when possible.
  */
 static int block_write(io_entity_t *entity, const uintptr_t buffer,
 		       size_t length, size_t *length_written)
 {
 	block_dev_state_t *cur;
 	io_block_spec_t *buf;
-	io_block_ops_t *ops;
 	int lba;
 	size_t block_size, left;
 	size_t nbytes;  /* number of bytes read in one iteration */
@@ -375,16 +645,18 @@ static int block_write(io_entity_t *entity, const uintptr_t buffer,
 	 * to be read and the end of the block
 	 */
 	size_t padding;
+	bool direct;
 
 	assert(entity->info != (uintptr_t)NULL);
 	cur = (block_dev_state_t *)entity->info;
-	ops = &(cur->dev_spec->ops);
 	buf = &(cur->dev_spec->buffer);
 	block_size = cur->dev_spec->block_size;
 	assert((length <= cur->size) &&
 	       (length > 0U) &&
-	       (ops->read != NULL) &&
-	       (ops->write != NULL));
+	       (cur->dev_spec->ops.read != NULL) &&
+	       (cur->dev_spec->ops.write != NULL));
+
+	direct = block_direct_io(cur, buffer);
 
 	/*
 	 * We don't know the number of bytes that we are going
@@ -409,7 +681,28 @@ static int block_write(io_entity_t *entity, const uintptr_t buffer,
 		 */
 		lba = (cur->file_pos + cur->base) / block_size;
 
-		if ((skip + left) > buf->length) {
+		if (direct && (skip == 0U) && (left >= block_size)) {
+			/* Write the whole blocks straight from the caller */
+			request = left & ~(block_size - 1U);
+			nbytes = block_dev_write(cur, lba, buffer + count,
+						 request);
+			nbytes &= ~(block_size - 1U);
+			if (nbytes == 0U) {
+				return -EIO;
+			}
+
+			cur->file_pos += nbytes;
+			count += nbytes;
+			continue;
+		}
+
+		if (direct && ((skip + left) > block_size)) {
+			/*
+			 * Only bounce the partial block at the start, the
+			 * following ones are written straight from the caller.
+			 */
+			request = block_size;
+		} else if ((skip + left) > buf->length) {
 			/*
 			 * The underlying read buffer is too small to
 			 * read all the required data - limit to just
@@ -443,7 +736,8 @@ static int block_write(io_entity_t *entity, const uintptr_t buffer,
 		 * writing
 		 */
 		if ((skip > 0U) || (padding > 0U)) {
-			request = ops->read(lba, buf->offset, request);
+			request = block_dev_read(cur, lba, buf->offset,
+						 request, buf->length);
 			/*
 			 * The read may return size less than
 			 * requested. Round down to the nearest block
@@ -468,7 +762,7 @@ static int block_write(io_entity_t *entity, const uintptr_t buffer,
 		       (void *)(buffer + count),
 		       nbytes);
 
-		request = ops->write(lba, buf->offset, request);
+		request = block_dev_write(cur, lba, buf->offset, request);
 		if (request <= skip)
 			return -EIO;
 
@@ -528,6 +822,11 @@ static int block_dev_open(const uintptr_t dev_spec, io_dev_info_t **dev_info)
 
 static int block_dev_close(io_dev_info_t *dev_info)
 {
+#if IO_BLOCK_CACHE_ENTRIES != 0
+	VERBOSE("io_block: cache hits %u, misses %u, blocks read ahead %u\n",
+		block_cache.hits, block_cache.misses, block_cache.read_ahead);
+#endif
+
 	return free_dev_info(dev_info);
 }
 
@@ -1,11 +1,12 @@
 /*
- * Copyright (c) 2014-2020, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2014-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <assert.h>
 #include <errno.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -25,6 +26,23 @@
 #define MAX_FIP_DEVICES		1
 #endif
 
+/*
+ * Number of files that can be open at the same time on each FIP device, for
+ * instance a certificate and the image it authenticates.
+ */
+#ifndef MAX_FIP_FILES
+#define MAX_FIP_FILES		2
+#endif
+
+/*
+ * Number of ToC entries cached per FIP device by fip_dev_init(). If a FIP
+ * holds more entries than this, lookups that miss the index fall back to
+ * scanning the ToC on the backend.
+ */
+#ifndef MAX_FIP_TOC_ENTRIES
+#define MAX_FIP_TOC_ENTRIES	32
+#endif
+
 /* Useful for printing UUIDs when debugging.*/
 #define PRINT_UUID2(x)								\
 	"%08x-%04hx-%04hx-%02hhx%02hhx-%02hhx%02hhx%02hhx%02hhx%02hhx%02hhx",	\
@@ -34,38 +52,44 @@
 		x.node[4], x.node[5]
 
 typedef struct {
+	bool in_use;
 	unsigned int file_pos;
 	fip_toc_entry_t entry;
+	const struct fip_dev_state *dev_state;
 } fip_file_state_t;
 
 /*
- * Maintain dev_spec per FIP Device
- * TODO - Add backend handles and file state
- * per FIP device here once backends like io_memmap
- * can support multiple open files
+ * Maintain dev_spec, backend handles and file states per FIP Device.
+ * As backends like io_memmap don't support multiple open files, the
+ * backend is only held open for the duration of each access, so the
+ * reads of the files open on a device can be interleaved.
+ *
+ * The ToC of the FIP is read by fip_dev_init() and kept sorted by UUID in
+ * toc_index[], so that opening a file does not need to access the backend.
+ * The index is rebuilt on every fip_dev_init(), as platforms may point the
+ * same backend spec at a different FIP between two calls.
  */
-typedef struct {
+typedef struct fip_dev_state {
 	uintptr_t dev_spec;
 	uint16_t plat_toc_flag;
+	bool toc_valid;
+	bool toc_truncated;
+	unsigned int toc_entries;
+	uintptr_t backend_dev_handle;
+	uintptr_t backend_image_spec;
+	fip_toc_entry_t toc_index[MAX_FIP_TOC_ENTRIES];
+	fip_file_state_t files[MAX_FIP_FILES];
 } fip_dev_state_t;
 
-/*
- * Only one file can be open across all FIP device
- * as backends like io_memmap don't support
- * multiple open files. The file state and
- * backend handle should be maintained per FIP device
- * if the same support is available in the backend
- */
-static fip_file_state_t current_fip_file = {0};
-static uintptr_t backend_dev_handle;
-static uintptr_t backend_image_spec;
-
 static fip_dev_state_t state_pool[MAX_FIP_DEVICES];
 static io_dev_info_t dev_info_pool[MAX_FIP_DEVICES];
 
 /* Track number of allocated fip devices */
 static unsigned int fip_dev_count;
 
+/* Number of io_read() calls issued on the backend, for debugging */
+static unsigned int fip_backend_reads;
+
 /* Firmware Image Package driver functions */
 static int fip_dev_open(const uintptr_t dev_spec, io_dev_info_t **dev_info);
 static int fip_file_open(io_dev_info_t *dev_info, const uintptr_t spec,
@@ -85,6 +109,14 @@ static inline int compare_uuids(const uuid_t *uuid1, const uuid_t *uuid2)
 }
 
 
+static inline bool is_null_uuid(const uuid_t *uuid)
+{
+	static const uuid_t uuid_null = { {0} }; /* Double braces for clang */
+
+	return compare_uuids(uuid, &uuid_null) == 0;
+}
+
+
 static inline int is_valid_header(fip_toc_header_t *header)
 {
 	if ((header->name == TOC_HEADER_NAME) && (header->serial_number != 0)) {
@@ -138,6 +170,189 @@ static int find_first_fip_state(const uintptr_t dev_spec,
 }
 
 
+/* Allocate a file state from the pool of a FIP device */
+static fip_file_state_t *allocate_file_state(fip_dev_state_t *state)
+{
+	unsigned int index;
+
+	for (index = 0U; index < (unsigned int)MAX_FIP_FILES; ++index) {
+		if (!state->files[index].in_use) {
+			state->files[index].in_use = true;
+			return &state->files[index];
+		}
+	}
+
+	return NULL;
+}
+
+/* Read from the backend, keeping track of the number of accesses */
+static int fip_backend_read(uintptr_t backend_handle, uintptr_t buffer,
+			    size_t length, size_t *length_read)
+{
+	fip_backend_reads++;
+
+	return io_read(backend_handle, buffer, length, length_read);
+}
+
+/* Look up a ToC entry by UUID in the sorted index of a FIP device */
+static const fip_toc_entry_t *fip_toc_index_lookup(const fip_dev_state_t *state,
+						   const uuid_t *uuid)
+{
+	unsigned int low = 0U;
+	unsigned int high = state->toc_entries;
+
+	while (low < high) {
+		unsigned int mid = low + ((high - low) / 2U);
+		int cmp = compare_uuids(&state->toc_index[mid].uuid, uuid);
+
+		if (cmp == 0) {
+			return &state->toc_index[mid];
+		} else if (cmp < 0) {
+			low = mid + 1U;
+		} else {
+			high = mid;
+		}
+	}
+
+	return NULL;
+}
+
+/*
+ * Read the ToC of the FIP, which immediately follows the header, into the
+ * index of a FIP device and sort it by UUID. The backend handle must be
+ * positioned right after the header. The whole ToC is read in a single access
+ * when the backend can report its size, and one entry at a time otherwise.
+ */
+static int fip_toc_index_build(fip_dev_state_t *state, uintptr_t backend_handle)
+{
+	int result;
+	size_t backend_len;
+	size_t toc_len = sizeof(state->toc_index);
+	size_t bytes_read;
+	unsigned int entries = 0U;
+	unsigned int i, j;
+
+	state->toc_valid = false;
+	state->toc_truncated = true;
+	state->toc_entries = 0U;
+
+	if (io_size(backend_handle, &backend_len) == 0) {
+		if (backend_len < sizeof(fip_toc_header_t)) {
+			return -ENOENT;
+		}
+		backend_len -= sizeof(fip_toc_header_t);
+		if (backend_len < toc_len) {
+			toc_len = backend_len - (backend_len %
+						 sizeof(fip_toc_entry_t));
+		}
+
+		result = fip_backend_read(backend_handle,
+					  (uintptr_t)state->toc_index, toc_len,
+					  &bytes_read);
+		if (result != 0) {
+			WARN("Failed to read FIP ToC (%i)\n", result);
+			return result;
+		}
+
+		while ((entries < (bytes_read / sizeof(fip_toc_entry_t))) &&
+		       !is_null_uuid(&state->toc_index[entries].uuid)) {
+			entries++;
+		}
+		if (entries < (bytes_read / sizeof(fip_toc_entry_t))) {
+			state->toc_truncated = false;
+		}
+	} else {
+		while (entries < (unsigned int)MAX_FIP_TOC_ENTRIES) {
+			result = fip_backend_read(backend_handle,
+					(uintptr_t)&state->toc_index[entries],
+					sizeof(fip_toc_entry_t), &bytes_read);
+			if (result != 0) {
+				WARN("Failed to read FIP ToC (%i)\n", result);
+				return result;
+			}
+			if (is_null_uuid(&state->toc_index[entries].uuid)) {
+				state->toc_truncated = false;
+				break;
+			}
+			entries++;
+		}
+	}
+
+	/* The ToC is short, insertion sort keeps the code small */
+	for (i = 1U; i < entries; i++) {
+		fip_toc_entry_t entry = state->toc_index[i];
+
+		for (j = i; j > 0U; j--) {
+			if (compare_uuids(&state->toc_index[j - 1U].uuid,
+					  &entry.uuid) <= 0) {
+				break;
+			}
+			state->toc_index[j] = state->toc_index[j - 1U];
+		}
+		state->toc_index[j] = entry;
+	}
+
+	state->toc_entries = entries;
+	state->toc_valid = true;
+
+	if (state->toc_truncated) {
+		WARN("FIP ToC exceeds MAX_FIP_TOC_ENTRIES (%u)\n",
+		     (unsigned int)MAX_FIP_TOC_ENTRIES);
+	}
+	VERBOSE("FIP ToC indexed: %u entries, %u backend reads\n",
+		entries, fip_backend_reads);
+
+	return 0;
+}
+
+/*
+ * Scan the ToC on the backend for a file. This is only needed for files that
+ * did not fit in the index of the FIP device.
+ */
+static int fip_toc_scan(const fip_dev_state_t *state, const uuid_t *uuid,
+			fip_toc_entry_t *entry)
+{
+	int result;
+	uintptr_t backend_handle;
+	size_t bytes_read;
+
+	/* Attempt to access the FIP image */
+	result = io_open(state->backend_dev_handle, state->backend_image_spec,
+			 &backend_handle);
+	if (result != 0) {
+		WARN("Failed to open Firmware Image Package (%i)\n", result);
+		return -ENOENT;
+	}
+
+	/* Seek past the FIP header into the Table of Contents */
+	result = io_seek(backend_handle, IO_SEEK_SET,
+			 (signed long long)sizeof(fip_toc_header_t));
+	if (result != 0) {
+		WARN("fip_file_open: failed to seek\n");
+		result = -ENOENT;
+		goto fip_toc_scan_close;
+	}
+
+	result = -ENOENT;
+	do {
+		int ret = fip_backend_read(backend_handle, (uintptr_t)entry,
+					   sizeof(*entry), &bytes_read);
+		if (ret != 0) {
+			WARN("Failed to read FIP (%i)\n", ret);
+			result = ret;
+			break;
+		}
+		if (compare_uuids(&entry->uuid, uuid) == 0) {
+			result = 0;
+		}
+	} while ((result == -ENOENT) && !is_null_uuid(&entry->uuid));
+
+ fip_toc_scan_close:
+	io_close(backend_handle);
+
+	return result;
+}
+
 /* Allocate a device info from the pool and return a pointer to it */
 static int allocate_dev_info(io_dev_info_t **dev_info)
 {
@@ -183,8 +398,8 @@ static int free_dev_info(io_dev_info_t *dev_info)
 
 /*
  * Multiple FIP devices can be opened depending on the value of
- * MAX_FIP_DEVICES. Given that there is only one backend, only a
- * single file can be open at a time by any FIP device.
+ * MAX_FIP_DEVICES. Each device has its own backend and can have up
+ * to MAX_FIP_FILES files open at the same time.
  */
 static int fip_dev_open(const uintptr_t dev_spec,
 			 io_dev_info_t **dev_info)
@@ -212,7 +427,7 @@ static int fip_dev_open(const uintptr_t dev_spec,
 }
 
 
-/* Do some basic package checks. */
+/* Do some basic package checks and index the ToC. */
 static int fip_dev_init(io_dev_info_t *dev_info, const uintptr_t init_params)
 {
 	int result;
@@ -225,10 +440,11 @@ static int fip_dev_init(io_dev_info_t *dev_info, const uintptr_t init_params)
 	assert(dev_info != NULL);
 
 	state = (fip_dev_state_t *)dev_info->info;
+	state->toc_valid = false;
 
 	/* Obtain a reference to the image by querying the platform layer */
-	result = plat_get_image_source(image_id, &backend_dev_handle,
-				       &backend_image_spec);
+	result = plat_get_image_source(image_id, &state->backend_dev_handle,
+				       &state->backend_image_spec);
 	if (result != 0) {
 		WARN("Failed to obtain reference to image id=%u (%i)\n",
 			image_id, result);
@@ -237,7 +453,7 @@ static int fip_dev_init(io_dev_info_t *dev_info, const uintptr_t init_params)
 	}
 
 	/* Attempt to access the FIP image */
-	result = io_open(backend_dev_handle, backend_image_spec,
+	result = io_open(state->backend_dev_handle, state->backend_image_spec,
 			 &backend_handle);
 	if (result != 0) {
 		WARN("Failed to access image id=%u (%i)\n", image_id, result);
@@ -245,8 +461,8 @@ static int fip_dev_init(io_dev_info_t *dev_info, const uintptr_t init_params)
 		goto fip_dev_init_exit;
 	}
 
-	result = io_read(backend_handle, (uintptr_t)&header, sizeof(header),
-			&bytes_read);
+	result = fip_backend_read(backend_handle, (uintptr_t)&header,
+				  sizeof(header), &bytes_read);
 	if (result == 0) {
 		if (!is_valid_header(&header)) {
 			WARN("Firmware Image Package header check failed.\n");
@@ -258,6 +474,12 @@ static int fip_dev_init(io_dev_info_t *dev_info, const uintptr_t init_params)
 			 * bits [32-47] in fip header.
 			 */
 			state->plat_toc_flag = (header.flags >> 32) & 0xffff;
+
+			/*
+			 * The backend spec may have been updated in place to
+			 * describe another FIP, so always rebuild the index.
+			 */
+			result = fip_toc_index_build(state, backend_handle);
 		}
 	}
 
@@ -270,11 +492,17 @@ static int fip_dev_init(io_dev_info_t *dev_info, const uintptr_t init_params)
 /* Close a connection to the FIP device */
 static int fip_dev_close(io_dev_info_t *dev_info)
 {
-	/* TODO: Consider tracking open files and cleaning them up here */
+	fip_dev_state_t *state;
+
+	assert(dev_info != NULL);
 
-	/* Clear the backend. */
-	backend_dev_handle = (uintptr_t)NULL;
-	backend_image_spec = (uintptr_t)NULL;
+	/*
+	 * Clear the backend. The file states of the device are released
+	 * along with the rest of its state by free_dev_info().
+	 */
+	state = (fip_dev_state_t *)dev_info->info;
+	state->backend_dev_handle = (uintptr_t)NULL;
+	state->backend_image_spec = (uintptr_t)NULL;
 
 	return free_dev_info(dev_info);
 }
@@ -284,81 +512,54 @@ static int fip_dev_close(io_dev_info_t *dev_info)
 static int fip_file_open(io_dev_info_t *dev_info, const uintptr_t spec,
 			 io_entity_t *entity)
 {
-	int result;
-	uintptr_t backend_handle;
+	int result = 0;
 	const io_uuid_spec_t *uuid_spec = (io_uuid_spec_t *)spec;
-	static const uuid_t uuid_null = { {0} }; /* Double braces for clang */
-	size_t bytes_read;
-	int found_file = 0;
+	fip_dev_state_t *state;
+	const fip_toc_entry_t *entry;
+	fip_file_state_t *fp;
 
+	assert(dev_info != NULL);
 	assert(uuid_spec != NULL);
 	assert(entity != NULL);
 
-	/* Can only have one file open at a time for the moment. We need to
-	 * track state like file cursor position. We know the header lives at
-	 * offset zero, so this entry should never be zero for an active file.
-	 * When the system supports dynamic memory allocation we can allow more
-	 * than one open file at a time if needed.
-	 */
-	if (current_fip_file.entry.offset_address != 0U) {
-		WARN("fip_file_open : Only one open file at a time.\n");
-		return -ENFILE;
+	state = (fip_dev_state_t *)dev_info->info;
+
+	if (!state->toc_valid) {
+		WARN("fip_file_open: FIP ToC not indexed\n");
+		return -ENOENT;
 	}
 
-	/* Attempt to access the FIP image */
-	result = io_open(backend_dev_handle, backend_image_spec,
-			 &backend_handle);
-	if (result != 0) {
-		WARN("Failed to open Firmware Image Package (%i)\n", result);
-		result = -ENOENT;
-		goto fip_file_open_exit;
+	/* We need to track state like file cursor position for each open file,
+	 * so the number of open files is bounded by the pool of the device.
+	 */
+	fp = allocate_file_state(state);
+	if (fp == NULL) {
+		WARN("fip_file_open : Too many open files.\n");
+		return -ENFILE;
 	}
 
-	/* Seek past the FIP header into the Table of Contents */
-	result = io_seek(backend_handle, IO_SEEK_SET,
-			 (signed long long)sizeof(fip_toc_header_t));
-	if (result != 0) {
-		WARN("fip_file_open: failed to seek\n");
+	entry = fip_toc_index_lookup(state, &uuid_spec->uuid);
+	if (entry != NULL) {
+		fp->entry = *entry;
+	} else if (state->toc_truncated) {
+		result = fip_toc_scan(state, &uuid_spec->uuid, &fp->entry);
+	} else {
+		/* Did not find the file in the FIP. */
 		result = -ENOENT;
-		goto fip_file_open_close;
 	}
 
-	found_file = 0;
-	do {
-		result = io_read(backend_handle,
-				 (uintptr_t)&current_fip_file.entry,
-				 sizeof(current_fip_file.entry),
-				 &bytes_read);
-		if (result == 0) {
-			if (compare_uuids(&current_fip_file.entry.uuid,
-					  &uuid_spec->uuid) == 0) {
-				found_file = 1;
-			}
-		} else {
-			WARN("Failed to read FIP (%i)\n", result);
-			goto fip_file_open_close;
-		}
-	} while ((found_file == 0) &&
-			(compare_uuids(&current_fip_file.entry.uuid,
-				&uuid_null) != 0));
-
-	if (found_file == 1) {
+	if (result == 0) {
 		/* All fine. Update entity info with file state and return. Set
-		 * the file position to 0. The 'current_fip_file.entry' holds
-		 * the base and size of the file.
+		 * the file position to 0. The 'fp->entry' holds the base and
+		 * size of the file.
 		 */
-		current_fip_file.file_pos = 0;
-		entity->info = (uintptr_t)&current_fip_file;
+		fp->file_pos = 0;
+		fp->dev_state = state;
+		entity->info = (uintptr_t)fp;
 	} else {
-		/* Did not find the file in the FIP. */
-		current_fip_file.entry.offset_address = 0;
-		result = -ENOENT;
+		zeromem(fp, sizeof(*fp));
 	}
 
- fip_file_open_close:
-	io_close(backend_handle);
-
- fip_file_open_exit:
 	return result;
 }
 
@@ -389,17 +590,17 @@ static int fip_file_read(io_entity_t *entity, uintptr_t buffer, size_t length,
 	assert(length_read != NULL);
 	assert(entity->info != (uintptr_t)NULL);
 
+	fp = (fip_file_state_t *)entity->info;
+
 	/* Open the backend, attempt to access the blob image */
-	result = io_open(backend_dev_handle, backend_image_spec,
-			 &backend_handle);
+	result = io_open(fp->dev_state->backend_dev_handle,
+			 fp->dev_state->backend_image_spec, &backend_handle);
 	if (result != 0) {
 		WARN("Failed to open FIP (%i)\n", result);
 		result = -ENOENT;
 		goto fip_file_read_exit;
 	}
 
-	fp = (fip_file_state_t *)entity->info;
-
 	/* Seek to the position in the FIP where the payload lives */
 	file_offset = fp->entry.offset_address + fp->file_pos;
 	result = io_seek(backend_handle, IO_SEEK_SET,
@@ -410,7 +611,7 @@ static int fip_file_read(io_entity_t *entity, uintptr_t buffer, size_t length,
 		goto fip_file_read_close;
 	}
 
-	result = io_read(backend_handle, buffer, length, &bytes_read);
+	result = fip_backend_read(backend_handle, buffer, length, &bytes_read);
 	if (result != 0) {
 		/* We cannot read our data. Fail. */
 		WARN("Failed to read payload (%i)\n", result);
@@ -434,11 +635,16 @@ static int fip_file_read(io_entity_t *entity, uintptr_t buffer, size_t length,
 /* Close a file in package */
 static int fip_file_close(io_entity_t *entity)
 {
-	/* Clear our current file pointer.
+	fip_file_state_t *fp;
+
+	assert(entity != NULL);
+
+	/* Release the file state back to the pool of its device.
 	 * If we had malloc() we would free() here.
 	 */
-	if (current_fip_file.entry.offset_address != 0U) {
-		zeromem(&current_fip_file, sizeof(current_fip_file));
+	fp = (fip_file_state_t *)entity->info;
+	if (fp != NULL) {
+		zeromem(fp, sizeof(*fp));
 	}
 
 	/* Clear the Entity info. */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2022, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2019-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -21,6 +21,8 @@ typedef struct {
 	unsigned long long	pos;		/* Offset in bytes */
 	unsigned long long	size;		/* Size of device in bytes */
 	unsigned long long	extra_offset;	/* Extra offset in bytes */
+	uintptr_t		mm_base;	/* Memory-mapped window */
+	size_t			mm_size;	/* Window size, 0 if none */
 } mtd_dev_state_t;
 
 io_type_t device_type_mtd(void);
@@ -129,6 +131,34 @@ static int mtd_add_extra_offset(mtd_dev_state_t *cur, size_t *extra_offset)
 	return 0;
 }
 
+/* Reads fall back on ops->read() if the device cannot be mapped */
+static void mtd_dirmap_enable(mtd_dev_state_t *cur)
+{
+	io_mtd_ops_t *ops = &cur->dev_spec->ops;
+
+	if ((cur->size == 0ULL) || (ops->dirmap_enable == NULL) ||
+	    (ops->dirmap_disable == NULL)) {
+		return;
+	}
+
+	if (ops->dirmap_enable(&cur->mm_base, &cur->mm_size) != 0) {
+		cur->mm_base = 0U;
+		cur->mm_size = 0U;
+	}
+}
+
+/* Leave memory-mapped mode, the controller must not be left in it */
+static void mtd_dirmap_disable(mtd_dev_state_t *cur)
+{
+	if (cur->mm_size == 0U) {
+		return;
+	}
+
+	cur->dev_spec->ops.dirmap_disable();
+	cur->mm_base = 0U;
+	cur->mm_size = 0U;
+}
+
 static int mtd_open(io_dev_info_t *dev_info, const uintptr_t spec,
 		    io_entity_t *entity)
 {
@@ -153,6 +183,8 @@ static int mtd_open(io_dev_info_t *dev_info, const uintptr_t spec,
 
 	cur->base += extra_offset;
 
+	mtd_dirmap_enable(cur);
+
 	return 0;
 }
 
@@ -205,6 +237,7 @@ static int mtd_read(io_entity_t *entity, uintptr_t buffer, size_t length,
 {
 	mtd_dev_state_t *cur;
 	io_mtd_ops_t *ops;
+	unsigned long long offset;
 	int ret;
 
 	assert(entity->info != (uintptr_t)NULL);
@@ -220,10 +253,16 @@ static int mtd_read(io_entity_t *entity, uintptr_t buffer, size_t length,
 		return -EINVAL;
 	}
 
-	ret = ops->read(cur->base + cur->pos + cur->extra_offset, buffer,
-			length, out_length);
-	if (ret < 0) {
-		return ret;
+	offset = cur->base + cur->pos + cur->extra_offset;
+	if ((offset < cur->mm_size) && (length <= (cur->mm_size - offset))) {
+		memcpy((void *)buffer, (void *)(cur->mm_base + offset),
+		       length);
+		*out_length = length;
+	} else {
+		ret = ops->read(offset, buffer, length, out_length);
+		if (ret < 0) {
+			return ret;
+		}
 	}
 
 	assert(*out_length == length);
@@ -234,6 +273,10 @@ static int mtd_read(io_entity_t *entity, uintptr_t buffer, size_t length,
 
 static int mtd_close(io_entity_t *entity)
 {
+	assert(entity->info != (uintptr_t)NULL);
+
+	mtd_dirmap_disable((mtd_dev_state_t *)entity->info);
+
 	entity->info = (uintptr_t)NULL;
 
 	return 0;
@@ -271,6 +314,8 @@ static int mtd_dev_open(const uintptr_t dev_spec, io_dev_info_t **dev_info)
 
 static int mtd_dev_close(io_dev_info_t *dev_info)
 {
+	mtd_dirmap_disable((mtd_dev_state_t *)dev_info->info);
+
 	return free_dev_info(dev_info);
 }
 
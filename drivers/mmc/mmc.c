@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2022, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2018-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -253,6 +253,146 @@ static int mmc_set_ios(unsigned int clk, unsigned int bus_width)
 	return ops->set_ios(clk, width);
 }
 
+/*
+ * Switch the timing interface of the card, then the one of the host, before
+ * checking the card status as the new timing is in use from the switch on.
+ */
+static int mmc_switch_timing(unsigned int timing, unsigned int freq)
+{
+	int ret;
+
+	ret = mmc_send_cmd(MMC_CMD(6),
+			   EXTCSD_WRITE_BYTES | EXTCSD_CMD(CMD_EXTCSD_HS_TIMING) |
+			   EXTCSD_VALUE(timing) | EXTCSD_CMD_SET_NORMAL,
+			   MMC_RESPONSE_R1B, NULL);
+	if (ret != 0) {
+		return ret;
+	}
+
+	ret = ops->set_timing(timing, freq);
+	if (ret != 0) {
+		return ret;
+	}
+
+	do {
+		ret = mmc_device_state();
+		if (ret < 0) {
+			return ret;
+		}
+	} while (ret == MMC_STATE_PRG);
+
+	return 0;
+}
+
+static int mmc_select_hs200(void)
+{
+	int ret;
+
+	ret = mmc_switch_timing(MMC_TIMING_HS200, MMC_HS200_MAX_FREQ);
+	if (ret != 0) {
+		return ret;
+	}
+
+	/* CMD21: SEND_TUNING_BLOCK */
+	return ops->execute_tuning(MMC_CMD(21));
+}
+
+/* HS400 is entered from HS200 once tuned, through high speed DDR */
+static int mmc_select_hs400(unsigned int clk)
+{
+	int ret;
+
+	ret = mmc_switch_timing(MMC_TIMING_HS, MMC_HS_MAX_FREQ);
+	if (ret != 0) {
+		return ret;
+	}
+
+	ret = mmc_set_ext_csd(CMD_EXTCSD_BUS_WIDTH, MMC_BUS_WIDTH_DDR_8);
+	if (ret != 0) {
+		return ret;
+	}
+
+	ret = ops->set_ios(clk, MMC_BUS_WIDTH_DDR_8);
+	if (ret != 0) {
+		return ret;
+	}
+
+	return mmc_switch_timing(MMC_TIMING_HS400, MMC_HS200_MAX_FREQ);
+}
+
+/* Go back to the fastest timing not needing tuning */
+static int mmc_fall_back_timing(unsigned int clk, unsigned int bus_width,
+				unsigned int freq)
+{
+	unsigned int timing = MMC_TIMING_BACKWARD;
+	int ret;
+
+	if ((mmc_ext_csd[CMD_EXTCSD_DEVICE_TYPE] &
+	     EXT_CSD_DEVICE_TYPE_HS_52) != 0U) {
+		timing = MMC_TIMING_HS;
+		freq = MMC_HS_MAX_FREQ;
+	}
+
+	ret = mmc_switch_timing(timing, freq);
+	if (ret != 0) {
+		return ret;
+	}
+
+	ret = mmc_set_ext_csd(CMD_EXTCSD_BUS_WIDTH, bus_width);
+	if (ret != 0) {
+		return ret;
+	}
+
+	mmc_dev_info->max_bus_freq = freq;
+
+	return ops->set_ios(clk, bus_width);
+}
+
+/*
+ * Select the fastest eMMC timing supported by both the card and the host:
+ * HS400 on an 8-bit bus, else HS200. Both need the host to provide the
+ * set_timing and execute_tuning hooks. If tuning or the HS400 switch fails,
+ * the card is brought back to high speed.
+ */
+static int mmc_select_timing(unsigned int clk, unsigned int bus_width)
+{
+	unsigned int device_type = mmc_ext_csd[CMD_EXTCSD_DEVICE_TYPE];
+	unsigned int freq = mmc_dev_info->max_bus_freq;
+	int ret;
+
+	if ((ops->set_timing == NULL) || (ops->execute_tuning == NULL) ||
+	    (mmc_csd.spec_vers != 4U) ||
+	    ((device_type & EXT_CSD_DEVICE_TYPE_HS200) == 0U) ||
+	    ((bus_width != MMC_BUS_WIDTH_4) &&
+	     (bus_width != MMC_BUS_WIDTH_8))) {
+		return 0;
+	}
+
+	ret = mmc_select_hs200();
+	if (ret != 0) {
+		WARN("MMC: HS200 tuning failed (%d), using high speed\n", ret);
+		return mmc_fall_back_timing(clk, bus_width, freq);
+	}
+
+	mmc_dev_info->max_bus_freq = MMC_HS200_MAX_FREQ;
+
+	if ((bus_width != MMC_BUS_WIDTH_8) ||
+	    ((device_type & EXT_CSD_DEVICE_TYPE_HS400) == 0U)) {
+		INFO("MMC: HS200 mode\n");
+		return 0;
+	}
+
+	ret = mmc_select_hs400(clk);
+	if (ret != 0) {
+		WARN("MMC: HS400 switch failed (%d), using high speed\n", ret);
+		return mmc_fall_back_timing(clk, bus_width, freq);
+	}
+
+	INFO("MMC: HS400 mode\n");
+
+	return 0;
+}
+
 static int mmc_fill_device_info(void)
 {
 	unsigned long long c_size;
@@ -557,6 +697,10 @@ static int mmc_enumerate(unsigned int clk, unsigned int bus_width)
 		return ret;
 	}
 
+	if (mmc_dev_info->mmc_dev_type == MMC_IS_EMMC) {
+		return mmc_select_timing(clk, bus_width);
+	}
+
 	if (is_sd_cmd6_enabled() &&
 	    (mmc_dev_info->mmc_dev_type == MMC_IS_SD_HC)) {
 		/* Try to switch to High Speed Mode */
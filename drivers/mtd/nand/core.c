@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2022, STMicroelectronics - All Rights Reserved
+ * Copyright (c) 2019-2026, STMicroelectronics - All Rights Reserved
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -15,11 +15,25 @@
 
 #include <platform_def.h>
 
+/* Number of blocks covered by the bad block table */
+#ifndef NAND_BBT_MAX_BLOCKS
+#define NAND_BBT_MAX_BLOCKS		4096U
+#endif
+
 /*
  * Define a single nand_device used by specific NAND frameworks.
  */
 static struct nand_device nand_dev;
 
+/*
+ * Bad block table, filled in as blocks are first checked so that the bad
+ * block markers of a block are read at most once per boot.
+ */
+static struct {
+	uint32_t checked[NAND_BBT_MAX_BLOCKS / 32U];
+	uint32_t bad[NAND_BBT_MAX_BLOCKS / 32U];
+} nand_bbt;
+
 #pragma weak plat_get_scratch_buffer
 void plat_get_scratch_buffer(void **buffer_addr, size_t *buf_size)
 {
@@ -32,6 +46,33 @@ void plat_get_scratch_buffer(void **buffer_addr, size_t *buf_size)
 	*buf_size = sizeof(scratch_buff);
 }
 
+static int nand_block_is_bad(unsigned int block)
+{
+	unsigned int idx = block / 32U;
+	uint32_t mask = BIT_32(block % 32U);
+	int is_bad;
+
+	if (block >= NAND_BBT_MAX_BLOCKS) {
+		return nand_dev.mtd_block_is_bad(block);
+	}
+
+	if ((nand_bbt.checked[idx] & mask) != 0U) {
+		return ((nand_bbt.bad[idx] & mask) != 0U) ? 1 : 0;
+	}
+
+	is_bad = nand_dev.mtd_block_is_bad(block);
+	if (is_bad < 0) {
+		return is_bad;
+	}
+
+	nand_bbt.checked[idx] |= mask;
+	if (is_bad == 1) {
+		nand_bbt.bad[idx] |= mask;
+	}
+
+	return is_bad;
+}
+
 int nand_read(unsigned int offset, uintptr_t buffer, size_t length,
 	      size_t *length_read)
 {
@@ -42,6 +83,7 @@ int nand_read(unsigned int offset, uintptr_t buffer, size_t length,
 	unsigned int nb_pages = nand_dev.block_size / nand_dev.page_size;
 	unsigned int start_offset = offset % nand_dev.page_size;
 	unsigned int page;
+	unsigned int count;
 	unsigned int bytes_read;
 	int is_bad;
 	int ret;
@@ -63,7 +105,7 @@ int nand_read(unsigned int offset, uintptr_t buffer, size_t length,
 	}
 
 	while (block <= end_block) {
-		is_bad = nand_dev.mtd_block_is_bad(block);
+		is_bad = nand_block_is_bad(block);
 		if (is_bad < 0) {
 			return is_bad;
 		}
@@ -82,7 +124,9 @@ int nand_read(unsigned int offset, uintptr_t buffer, size_t length,
 			return -EIO;
 		}
 
-		for (page = page_start; page < nb_pages; page++) {
+		for (page = page_start; page < nb_pages; page += count) {
+			count = 1U;
+
 			if ((start_offset != 0U) ||
 			    (length < nand_dev.page_size)) {
 				ret = nand_dev.mtd_read_page(
@@ -103,14 +147,26 @@ int nand_read(unsigned int offset, uintptr_t buffer, size_t length,
 
 				start_offset = 0U;
 			} else {
-				ret = nand_dev.mtd_read_page(&nand_dev,
+				count = MIN(nb_pages - page,
+					    (unsigned int)(length /
+							   nand_dev.page_size));
+
+				if ((count > 1U) &&
+				    (nand_dev.mtd_read_pages != NULL)) {
+					ret = nand_dev.mtd_read_pages(&nand_dev,
+						(block * nb_pages) + page,
+						count, buffer);
+				} else {
+					count = 1U;
+					ret = nand_dev.mtd_read_page(&nand_dev,
 						(block * nb_pages) + page,
 						buffer);
+				}
 				if (ret != 0) {
 					return ret;
 				}
 
-				bytes_read = nand_dev.page_size;
+				bytes_read = count * nand_dev.page_size;
 			}
 
 			length -= bytes_read;
@@ -152,7 +208,7 @@ int nand_seek_bb(uintptr_t base, unsigned int offset, size_t *extra_offset)
 			return -EIO;
 		}
 
-		is_bad = nand_dev.mtd_block_is_bad(block);
+		is_bad = nand_block_is_bad(block);
 		if (is_bad < 0) {
 			return is_bad;
 		}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2022, STMicroelectronics - All Rights Reserved
+ * Copyright (c) 2019-2026, STMicroelectronics - All Rights Reserved
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -323,6 +323,7 @@ static int nand_read_param_page(void)
 	rawnand_dev.nand_dev->block_size = page.num_pages_per_blk *
 					   page.bytes_per_page;
 	rawnand_dev.nand_dev->page_size = page.bytes_per_page;
+	rawnand_dev.cache_read = (page.opt_cmd & ONFI_OPT_CMD_READ_CACHE) != 0U;
 	rawnand_dev.nand_dev->size = page.num_pages_per_blk *
 				     page.bytes_per_page *
 				     page.num_blk_in_lun * page.num_lun;
@@ -394,6 +395,53 @@ static int nand_mtd_read_page_raw(struct nand_device *nand, unsigned int page,
 				  rawnand_dev.nand_dev->page_size);
 }
 
+/*
+ * Read consecutive pages with the read cache sequential command, so that the
+ * transfer of a page overlaps the array read of the next one.
+ */
+static int nand_mtd_read_pages_raw(struct nand_device *nand,
+				   unsigned int page, unsigned int nb_pages,
+				   uintptr_t buffer)
+{
+	unsigned int i;
+	uint8_t cmd;
+	int ret;
+
+	ret = nand_read_page_cmd(page, 0U, 0U, 0U);
+	if (ret != 0) {
+		return ret;
+	}
+
+	for (i = 0U; i < nb_pages; i++) {
+		if ((i + 1U) < nb_pages) {
+			cmd = NAND_CMD_READ_CACHE_SEQ;
+		} else {
+			cmd = NAND_CMD_READ_CACHE_END;
+		}
+
+		ret = nand_send_cmd(cmd, NAND_TWB_MAX);
+		if (ret != 0) {
+			return ret;
+		}
+
+		ret = nand_send_wait(PSEC_TO_MSEC(NAND_TRCBSY_MAX),
+				     NAND_TRR_MIN);
+		if (ret != 0) {
+			return ret;
+		}
+
+		ret = nand_read_data((uint8_t *)buffer, nand->page_size,
+				     false);
+		if (ret != 0) {
+			return ret;
+		}
+
+		buffer += nand->page_size;
+	}
+
+	return 0;
+}
+
 void nand_raw_ctrl_init(const struct nand_ctrl_ops *ops)
 {
 	rawnand_dev.ops = ops;
@@ -441,5 +489,11 @@ int nand_raw_init(unsigned long long *size, unsigned int *erase_size)
 
 	rawnand_dev.ops->setup(rawnand_dev.nand_dev);
 
+	/* Cache reads bypass the ECC handling of controller page reads */
+	if (rawnand_dev.cache_read &&
+	    (rawnand_dev.nand_dev->mtd_read_page == nand_mtd_read_page_raw)) {
+		rawnand_dev.nand_dev->mtd_read_pages = nand_mtd_read_pages_raw;
+	}
+
 	return 0;
 }
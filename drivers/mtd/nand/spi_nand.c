@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023,  STMicroelectronics - All Rights Reserved
+ * Copyright (c) 2019-2026,  STMicroelectronics - All Rights Reserved
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -259,6 +259,79 @@ static int spi_nand_mtd_read_page(struct nand_device *nand, unsigned int page,
 				  spinand_dev.nand_dev->page_size, true);
 }
 
+static int spi_nand_read_cache_cmd(uint8_t opcode)
+{
+	struct spi_mem_op op;
+
+	zeromem(&op, sizeof(struct spi_mem_op));
+	op.cmd.opcode = opcode;
+	op.cmd.buswidth = SPI_MEM_BUSWIDTH_1_LINE;
+
+	return spi_mem_exec_op(&op);
+}
+
+/*
+ * Read consecutive pages with the page read cache sequential command, so that
+ * the transfer of a page from the cache overlaps the array read of the next
+ * one.
+ */
+static int spi_nand_mtd_read_pages(struct nand_device *nand, unsigned int page,
+				   unsigned int nb_pages, uintptr_t buffer)
+{
+	unsigned int i;
+	uint8_t status;
+	uint8_t opcode;
+	int ret;
+
+	ret = spi_nand_ecc_enable(true);
+	if (ret != 0) {
+		return ret;
+	}
+
+	ret = spi_nand_load_page(page);
+	if (ret != 0) {
+		return ret;
+	}
+
+	ret = spi_nand_wait_ready(&status);
+	if (ret != 0) {
+		return ret;
+	}
+
+	for (i = 0U; i < nb_pages; i++) {
+		if ((i + 1U) < nb_pages) {
+			opcode = SPI_NAND_OP_READ_CACHE_SEQ;
+		} else {
+			opcode = SPI_NAND_OP_READ_CACHE_LAST;
+		}
+
+		ret = spi_nand_read_cache_cmd(opcode);
+		if (ret != 0) {
+			return ret;
+		}
+
+		/* ECC status is the one of the page moved to the cache */
+		ret = spi_nand_wait_ready(&status);
+		if (ret != 0) {
+			return ret;
+		}
+
+		ret = spi_nand_read_from_cache(page + i, 0U, (uint8_t *)buffer,
+					       nand->page_size);
+		if (ret != 0) {
+			return ret;
+		}
+
+		if ((status & SPI_NAND_STATUS_ECC_UNCOR) != 0U) {
+			return -EBADMSG;
+		}
+
+		buffer += nand->page_size;
+	}
+
+	return 0;
+}
+
 int spi_nand_init(unsigned long long *size, unsigned int *erase_size)
 {
 	uint8_t id[SPI_NAND_MAX_ID_LEN];
@@ -289,6 +362,10 @@ int spi_nand_init(unsigned long long *size, unsigned int *erase_size)
 	       (spinand_dev.nand_dev->block_size != 0U) &&
 	       (spinand_dev.nand_dev->size != 0U));
 
+	if ((spinand_dev.flags & SPI_NAND_HAS_CACHE_READ) != 0U) {
+		spinand_dev.nand_dev->mtd_read_pages = spi_nand_mtd_read_pages;
+	}
+
 	ret = spi_nand_reset();
 	if (ret != 0) {
 		return ret;
@@ -1,10 +1,9 @@
 /*
- * Copyright (c) 2019-2022, STMicroelectronics - All Rights Reserved
+ * Copyright (c) 2019-2026, STMicroelectronics - All Rights Reserved
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
-#include <assert.h>
 #include <errno.h>
 #include <stddef.h>
 
@@ -27,6 +26,45 @@
 
 #define SPI_READY_TIMEOUT_US	40000U
 
+/* Serial Flash Discoverable Parameters, JESD216 */
+#define SFDP_SIGNATURE		0x50444653U	/* "SFDP" */
+#define SFDP_HEADERS_SIZE	16U	/* SFDP header and first parameter header */
+#define SFDP_BFPT_ID_LSB	0x00U
+#define SFDP_BFPT_ID_MSB	0xFFU
+#define SFDP_BFPT_MIN_DWORDS	9U
+#define SFDP_BFPT_DWORDS	16U
+
+/* Basic Flash Parameter Table fields, DWORDs numbered from 1 */
+#define BFPT_DWORD(i)		((i) - 1U)
+#define BFPT_DW1_ADDR_MASK	GENMASK_32(18, 17)
+#define BFPT_DW1_ADDR_4B_ONLY	BIT_32(18)
+#define BFPT_DW1_FAST_1_1_2	BIT_32(16)
+#define BFPT_DW1_FAST_1_2_2	BIT_32(20)
+#define BFPT_DW1_FAST_1_4_4	BIT_32(21)
+#define BFPT_DW1_FAST_1_1_4	BIT_32(22)
+#define BFPT_DW2_DENSITY_POW2	BIT_32(31)
+#define BFPT_DW2_DENSITY_N_MAX	35U	/* 2^35 bits, a 32-bit byte address */
+#define BFPT_WAIT_STATES(x)	((x) & 0x1FU)
+#define BFPT_MODE_CLOCKS(x)	(((x) >> 5) & 0x7U)
+#define BFPT_OPCODE(x)		(((x) >> 8) & 0xFFU)
+
+/*
+ * Fast read modes described in the BFPT, fastest first. Each one is flagged
+ * in DWORD 1 and has its opcode and dummy cycles in a 16-bit field.
+ */
+static const struct sfdp_read_mode {
+	uint8_t addr_buswidth;
+	uint8_t data_buswidth;
+	uint32_t support;
+	uint8_t dword;
+	uint8_t shift;
+} sfdp_read_modes[] = {
+	{ 4U, 4U, BFPT_DW1_FAST_1_4_4, BFPT_DWORD(3U), 0U },	/* 1-4-4 */
+	{ 1U, 4U, BFPT_DW1_FAST_1_1_4, BFPT_DWORD(3U), 16U },	/* 1-1-4 */
+	{ 2U, 2U, BFPT_DW1_FAST_1_2_2, BFPT_DWORD(4U), 16U },	/* 1-2-2 */
+	{ 1U, 2U, BFPT_DW1_FAST_1_1_2, BFPT_DWORD(4U), 0U },	/* 1-1-2 */
+};
+
 static struct nor_device nor_dev;
 
 #pragma weak plat_get_nor_data
@@ -322,6 +360,175 @@ int spi_nor_read(unsigned int offset, uintptr_t buffer, size_t length,
 	return 0;
 }
 
+static int spi_nor_read_sfdp(uint32_t offset, void *buf, size_t len)
+{
+	struct spi_mem_op op;
+
+	zeromem(&op, sizeof(struct spi_mem_op));
+	op.cmd.opcode = SPI_NOR_OP_READ_SFDP;
+	op.cmd.buswidth = SPI_MEM_BUSWIDTH_1_LINE;
+	op.addr.val = offset;
+	op.addr.nbytes = 3U;
+	op.addr.buswidth = SPI_MEM_BUSWIDTH_1_LINE;
+	op.dummy.nbytes = 1U;
+	op.dummy.buswidth = SPI_MEM_BUSWIDTH_1_LINE;
+	op.data.buswidth = SPI_MEM_BUSWIDTH_1_LINE;
+	op.data.dir = SPI_MEM_DATA_IN;
+	op.data.nbytes = len;
+	op.data.buf = buf;
+
+	return spi_mem_exec_op(&op);
+}
+
+static uint32_t sfdp_get_le32(const uint8_t *p)
+{
+	return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+	       ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/*
+ * Select the fastest read mode advertised by the SFDP Basic Flash Parameter
+ * Table that the SPI controller supports, with its opcode, dummy cycles and
+ * address width. Fill the device size if the platform left it unset.
+ *
+ * Return 0 if a read mode was selected, a negative error code otherwise, in
+ * which case the read operation is left untouched.
+ */
+static int spi_nor_sfdp_init(void)
+{
+	uint8_t headers[SFDP_HEADERS_SIZE];
+	uint8_t table[SFDP_BFPT_DWORDS * sizeof(uint32_t)];
+	uint32_t bfpt[SFDP_BFPT_DWORDS] = { 0U };
+	struct spi_mem_op op;
+	unsigned int nb_dwords;
+	unsigned int cycles;
+	unsigned int i;
+	uint32_t setting;
+	uint64_t density;
+	int ret;
+
+	ret = spi_nor_read_sfdp(0U, headers, sizeof(headers));
+	if (ret != 0) {
+		return ret;
+	}
+
+	/* The BFPT is mandatory, and described by the first header */
+	if ((sfdp_get_le32(&headers[0]) != SFDP_SIGNATURE) ||
+	    (headers[8] != SFDP_BFPT_ID_LSB) ||
+	    (headers[15] != SFDP_BFPT_ID_MSB) ||
+	    (headers[11] < SFDP_BFPT_MIN_DWORDS)) {
+		return -EINVAL;
+	}
+
+	nb_dwords = MIN((unsigned int)headers[11], SFDP_BFPT_DWORDS);
+	ret = spi_nor_read_sfdp(sfdp_get_le32(&headers[12]) & 0xFFFFFFU,
+				table, nb_dwords * sizeof(uint32_t));
+	if (ret != 0) {
+		return ret;
+	}
+
+	for (i = 0U; i < nb_dwords; i++) {
+		bfpt[i] = sfdp_get_le32(&table[i * sizeof(uint32_t)]);
+	}
+
+	if (nor_dev.size == 0U) {
+		setting = bfpt[BFPT_DWORD(2U)];
+		if ((setting & BFPT_DW2_DENSITY_POW2) != 0U) {
+			setting &= ~BFPT_DW2_DENSITY_POW2;
+			if (setting > BFPT_DW2_DENSITY_N_MAX) {
+				return -EINVAL;
+			}
+			density = BIT_64(setting);
+		} else {
+			density = (uint64_t)setting + 1U;
+		}
+		nor_dev.size = density / 8U;
+	}
+
+	for (i = 0U; i < ARRAY_SIZE(sfdp_read_modes); i++) {
+		const struct sfdp_read_mode *mode = &sfdp_read_modes[i];
+
+		if ((bfpt[BFPT_DWORD(1U)] & mode->support) == 0U) {
+			continue;
+		}
+
+		setting = bfpt[mode->dword] >> mode->shift;
+		cycles = BFPT_WAIT_STATES(setting) + BFPT_MODE_CLOCKS(setting);
+		if ((BFPT_OPCODE(setting) == 0U) ||
+		    (((cycles * mode->addr_buswidth) % 8U) != 0U)) {
+			continue;
+		}
+
+		zeromem(&op, sizeof(struct spi_mem_op));
+		op.cmd.opcode = BFPT_OPCODE(setting);
+		op.cmd.buswidth = SPI_MEM_BUSWIDTH_1_LINE;
+		op.addr.nbytes = 3U;
+		op.addr.buswidth = mode->addr_buswidth;
+		op.dummy.nbytes = (cycles * mode->addr_buswidth) / 8U;
+		op.dummy.buswidth = mode->addr_buswidth;
+		op.data.buswidth = mode->data_buswidth;
+		op.data.dir = SPI_MEM_DATA_IN;
+
+		if ((bfpt[BFPT_DWORD(1U)] & BFPT_DW1_ADDR_MASK) ==
+		    BFPT_DW1_ADDR_4B_ONLY) {
+			op.addr.nbytes = 4U;
+		}
+
+		/* Only the bus widths matter, give the check some data */
+		op.data.nbytes = 1U;
+		if (!spi_mem_supports_op(&op)) {
+			continue;
+		}
+		op.data.nbytes = 0U;
+
+		VERBOSE("SFDP read opcode 0x%x, %u dummy cycles, 1-%u-%u\n",
+			op.cmd.opcode, cycles, op.addr.buswidth,
+			op.data.buswidth);
+
+		nor_dev.read_op = op;
+
+		return 0;
+	}
+
+	return -ENOTSUP;
+}
+
+/*
+ * Map the device in the memory-mapped window of the SPI controller, using the
+ * read operation selected at init.
+ *
+ * Return 0 on success with the window base address and the mapped size,
+ * -ENOTSUP if the controller or device addressing does not allow it.
+ */
+int spi_nor_dirmap_enable(uintptr_t *base, size_t *size)
+{
+	int ret;
+
+	/* The window cannot follow bank register switches */
+	if ((nor_dev.flags & SPI_NOR_USE_BANK) != 0U) {
+		return -ENOTSUP;
+	}
+
+	ret = spi_mem_dirmap_enable(&nor_dev.read_op, base, size);
+	if (ret != 0) {
+		return ret;
+	}
+
+	if (nor_dev.size < *size) {
+		*size = (size_t)nor_dev.size;
+	}
+
+	return 0;
+}
+
+/*
+ * Leave the memory-mapped mode enabled with spi_nor_dirmap_enable().
+ */
+void spi_nor_dirmap_disable(void)
+{
+	spi_mem_dirmap_disable();
+}
+
 int spi_nor_init(unsigned long long *size, unsigned int *erase_size)
 {
 	int ret;
@@ -339,9 +546,19 @@ int spi_nor_init(unsigned long long *size, unsigned int *erase_size)
 		return -EINVAL;
 	}
 
-	assert(nor_dev.size != 0U);
+	if ((nor_dev.flags & SPI_NOR_NO_SFDP) == 0U) {
+		ret = spi_nor_sfdp_init();
+		if (ret != 0) {
+			VERBOSE("No usable SFDP read mode (%d)\n", ret);
+		}
+	}
+
+	if (nor_dev.size == 0U) {
+		ERROR("SPI NOR: unknown device size\n");
+		return -EINVAL;
+	}
 
-	if (nor_dev.size > BANK_SIZE) {
+	if ((nor_dev.size > BANK_SIZE) && (nor_dev.read_op.addr.nbytes == 3U)) {
 		nor_dev.flags |= SPI_NOR_USE_BANK;
 	}
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2022, STMicroelectronics - All Rights Reserved
+ * Copyright (c) 2019-2026, STMicroelectronics - All Rights Reserved
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -21,12 +21,16 @@
  * @cs:			ID of the chip select connected to the slave.
  * @mode:		SPI mode to use for this slave (see SPI mode flags).
  * @ops:		Ops defined by the bus.
+ * @dirmap:		Read operation of the memory-mapped window.
+ * @dirmap_enabled:	The memory-mapped window is enabled.
  */
 struct spi_slave {
 	unsigned int max_hz;
 	unsigned int cs;
 	unsigned int mode;
 	const struct spi_bus_ops *ops;
+	struct spi_mem_op dirmap;
+	bool dirmap_enabled;
 };
 
 static struct spi_slave spi_slave;
@@ -60,7 +64,13 @@ static bool spi_mem_check_buswidth_req(uint8_t buswidth, bool tx)
 	return false;
 }
 
-static bool spi_mem_supports_op(const struct spi_mem_op *op)
+/*
+ * spi_mem_supports_op() - Check if a memory operation is supported.
+ * @op: The memory operation to check.
+ *
+ * Return: true if the bus widths of @op are allowed by the SPI slave mode.
+ */
+bool spi_mem_supports_op(const struct spi_mem_op *op)
 {
 	if (!spi_mem_check_buswidth_req(op->cmd.buswidth, true)) {
 		return false;
@@ -149,6 +159,9 @@ static int spi_mem_check_bus_ops(const struct spi_bus_ops *ops)
 int spi_mem_exec_op(const struct spi_mem_op *op)
 {
 	const struct spi_bus_ops *ops = spi_slave.ops;
+	bool dirmap = spi_slave.dirmap_enabled;
+	uintptr_t base;
+	size_t size;
 	int ret;
 
 	VERBOSE("%s: cmd:%x mode:%d.%d.%d.%d addqr:%" PRIx64 " len:%x\n",
@@ -161,6 +174,11 @@ int spi_mem_exec_op(const struct spi_mem_op *op)
 		return -ENOTSUP;
 	}
 
+	/* The controller leaves memory-mapped mode for the operation */
+	if (dirmap) {
+		spi_mem_dirmap_disable();
+	}
+
 	ret = ops->claim_bus(spi_slave.cs);
 	if (ret != 0) {
 		WARN("Error claim_bus\n");
@@ -171,9 +189,76 @@ int spi_mem_exec_op(const struct spi_mem_op *op)
 
 	ops->release_bus();
 
+	if (dirmap && (spi_mem_dirmap_enable(&spi_slave.dirmap, &base,
+					     &size) != 0)) {
+		WARN("Error restoring memory-mapped mode\n");
+	}
+
 	return ret;
 }
 
+/*
+ * spi_mem_dirmap_enable() - Map the memory in the controller window.
+ * @op: The read operation used to access the memory through the window.
+ * @base: [out] Base address of the window.
+ * @size: [out] Size of the window in bytes.
+ *
+ * While the window is enabled, the memory can be read with plain loads. It is
+ * restored after any operation executed with spi_mem_exec_op().
+ *
+ * Return: 0 in case of success, a negative error code otherwise.
+ */
+int spi_mem_dirmap_enable(const struct spi_mem_op *op, uintptr_t *base,
+			  size_t *size)
+{
+	const struct spi_bus_ops *ops = spi_slave.ops;
+	int ret;
+
+	if ((ops->dirmap_enable == NULL) || (ops->dirmap_disable == NULL)) {
+		return -ENOTSUP;
+	}
+
+	if (!spi_mem_supports_op(op)) {
+		return -ENOTSUP;
+	}
+
+	spi_mem_dirmap_disable();
+
+	ret = ops->claim_bus(spi_slave.cs);
+	if (ret != 0) {
+		WARN("Error claim_bus\n");
+		return ret;
+	}
+
+	ret = ops->dirmap_enable(op, base, size);
+	if (ret != 0) {
+		ops->release_bus();
+		return ret;
+	}
+
+	spi_slave.dirmap = *op;
+	spi_slave.dirmap_enabled = true;
+
+	return 0;
+}
+
+/*
+ * spi_mem_dirmap_disable() - Disable the memory-mapped window, if enabled.
+ */
+void spi_mem_dirmap_disable(void)
+{
+	const struct spi_bus_ops *ops = spi_slave.ops;
+
+	if (!spi_slave.dirmap_enabled) {
+		return;
+	}
+
+	ops->dirmap_disable();
+	ops->release_bus();
+
+	spi_slave.dirmap_enabled = false;
+}
+
 /*
  * spi_mem_init_slave() - SPI slave device initialization.
  * @fdt: Pointer to the device tree blob.
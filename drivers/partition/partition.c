@@ -1,11 +1,12 @@
 /*
- * Copyright (c) 2016-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2016-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <assert.h>
 #include <inttypes.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -16,11 +17,27 @@
 #include <drivers/partition/partition.h>
 #include <drivers/partition/gpt.h>
 #include <drivers/partition/mbr.h>
+#include <lib/utils.h>
 #include <plat/common/platform.h>
 
+/* Number of GPT entries fetched by each read of the partition entry array */
+#define GPT_ENTRIES_PER_READ	16U
+
+/* Open-addressed lookup tables, twice as large as the list to keep probes short */
+#define PARTITION_INDEX_SLOTS	(2U * PLAT_PARTITION_MAX_ENTRIES)
+
 static uint8_t mbr_sector[PLAT_PARTITION_BLOCK_SIZE];
+static gpt_entry_t gpt_entries[GPT_ENTRIES_PER_READ];
 static partition_entry_list_t list;
 
+/*
+ * Indexes of the list entries, plus one, hashed by name and by unique
+ * partition GUID. An empty slot is 0, PLAT_PARTITION_MAX_ENTRIES is at most
+ * 128 so the values fit on a byte.
+ */
+static uint8_t name_index[PARTITION_INDEX_SLOTS];
+static uint8_t guid_index[PARTITION_INDEX_SLOTS];
+
 #if LOG_LEVEL >= LOG_LEVEL_VERBOSE
 static void dump_entries(int num)
 {
@@ -205,20 +222,21 @@ static int load_mbr_entries(uintptr_t image_handle)
 }
 
 /*
- * Try to read and load a single GPT entry.
+ * Try to read and load consecutive GPT entries.
  */
-static int load_gpt_entry(uintptr_t image_handle, gpt_entry_t *entry)
+static int load_gpt_entries(uintptr_t image_handle, gpt_entry_t *entries,
+			    unsigned int num)
 {
 	size_t bytes_read = 0U;
+	size_t length = num * sizeof(gpt_entry_t);
 	int result;
 
-	assert(entry != NULL);
-	result = io_read(image_handle, (uintptr_t)entry, sizeof(gpt_entry_t),
-			&bytes_read);
-	if ((result != 0) || (sizeof(gpt_entry_t) != bytes_read)) {
+	assert(entries != NULL);
+	result = io_read(image_handle, (uintptr_t)entries, length, &bytes_read);
+	if ((result != 0) || (length != bytes_read)) {
 		VERBOSE("GPT Entry read error(%i) or read mismatch occurred,"
 			"expected(%zu) and actual(%zu)\n", result,
-			sizeof(gpt_entry_t), bytes_read);
+			length, bytes_read);
 		return -EINVAL;
 	}
 
@@ -226,15 +244,19 @@ static int load_gpt_entry(uintptr_t image_handle, gpt_entry_t *entry)
 }
 
 /*
- * Retrieve each entry in the partition table, parse the data from each
+ * Retrieve the partition entry array by chunks, parse the data from each
  * entry and store them in the list of partition table entries.
+ * The CRC of the whole array is computed along to be checked against the
+ * header.
  */
 static int load_partition_gpt(uintptr_t image_handle, gpt_header_t header)
 {
 	const signed long long gpt_entry_offset = LBA(header.part_lba);
-	gpt_entry_t entry;
+	unsigned int max_entries = list.entry_count;
+	unsigned int valid_entries = 0U;
+	bool parsing = true;
 	int result;
-	unsigned int i;
+	unsigned int i, j, num;
 	uint32_t calc_crc = 0U;
 
 	result = io_seek(image_handle, IO_SEEK_SET, gpt_entry_offset);
@@ -244,32 +266,35 @@ static int load_partition_gpt(uintptr_t image_handle, gpt_header_t header)
 		return result;
 	}
 
-	for (i = 0U; i < list.entry_count; i++) {
-		result = load_gpt_entry(image_handle, &entry);
+	for (i = 0U; i < header.list_num; i += num) {
+		num = MIN(header.list_num - i, GPT_ENTRIES_PER_READ);
+
+		result = load_gpt_entries(image_handle, gpt_entries, num);
 		if (result != 0) {
 			VERBOSE("Failed to load gpt entry data(%u) error is (%i)\n",
 				i, result);
 			return result;
 		}
 
-		result = parse_gpt_entry(&entry, &list.list[i]);
-		if (result != 0) {
-			result = io_seek(image_handle, IO_SEEK_SET,
-					(gpt_entry_offset + (i * sizeof(gpt_entry_t))));
-			if (result != 0) {
-				VERBOSE("Failed to seek (%i)\n", result);
-				return result;
+		/*
+		 * Only the entries up to the first unused one are recorded,
+		 * the others are only part of the CRC of the array.
+		 */
+		for (j = 0U; parsing && (j < num); j++) {
+			if ((valid_entries == max_entries) ||
+			    (parse_gpt_entry(&gpt_entries[j],
+					     &list.list[valid_entries]) != 0)) {
+				parsing = false;
+			} else {
+				valid_entries++;
 			}
-			break;
 		}
 
-		/*
-		 * Calculate CRC of Partition entry array to compare with CRC
-		 * value in header
-		 */
-		calc_crc = tf_crc32(calc_crc, (uint8_t *)&entry, sizeof(gpt_entry_t));
+		calc_crc = tf_crc32(calc_crc, (uint8_t *)gpt_entries,
+				    num * sizeof(gpt_entry_t));
 	}
-	if (i == 0) {
+
+	if (valid_entries == 0U) {
 		VERBOSE("No Valid GPT Entries found\n");
 		return -EINVAL;
 	}
@@ -278,26 +303,9 @@ static int load_partition_gpt(uintptr_t image_handle, gpt_header_t header)
 	 * Only records the valid partition number that is loaded from
 	 * partition table.
 	 */
-	list.entry_count = i;
+	list.entry_count = valid_entries;
 	dump_entries(list.entry_count);
 
-	/*
-	 * If there are less valid entries than the possible number of entries
-	 * from the header, continue to load the partition entry table to
-	 * calculate the full CRC in order to check against the partition CRC
-	 * from the header for validation.
-	 */
-	for (; i < header.list_num; i++) {
-		result = load_gpt_entry(image_handle, &entry);
-		if (result != 0) {
-			VERBOSE("Failed to load gpt entry data(%u) error is (%i)\n",
-				i, result);
-			return result;
-		}
-
-		calc_crc = tf_crc32(calc_crc, (uint8_t *)&entry, sizeof(gpt_entry_t));
-	}
-
 	if (header.part_crc != calc_crc) {
 		ERROR("Invalid GPT Partition Array Entry CRC: Expected 0x%x"
 				" but got 0x%x.\n", header.part_crc, calc_crc);
@@ -393,10 +401,72 @@ static int load_primary_gpt(uintptr_t image_handle, unsigned int first_lba)
 	return load_partition_gpt(image_handle, header);
 }
 
+static unsigned int partition_hash(const void *key, size_t size)
+{
+	const uint8_t *p = key;
+	uint32_t hash = 2166136261U;	/* FNV-1a */
+	size_t i;
+
+	for (i = 0U; i < size; i++) {
+		hash = (hash ^ p[i]) * 16777619U;
+	}
+
+	return hash % PARTITION_INDEX_SLOTS;
+}
+
+static unsigned int name_hash(const char *name)
+{
+	return partition_hash(name, strnlen(name, EFI_NAMELEN));
+}
+
+static unsigned int guid_hash(const struct efi_guid *guid)
+{
+	return partition_hash(guid, sizeof(*guid));
+}
+
 /*
- * Load the partition table info based on the image id provided.
+ * Record each entry of the list in the lookup tables. On duplicated keys the
+ * first entry is kept, as returned by a linear search of the list.
  */
-int load_partition_table(unsigned int image_id)
+static void build_partition_index(void)
+{
+	unsigned int i, slot;
+
+	zeromem(name_index, sizeof(name_index));
+	zeromem(guid_index, sizeof(guid_index));
+
+	for (i = 0U; i < list.entry_count; i++) {
+		for (slot = name_hash(list.list[i].name);
+		     name_index[slot] != 0U;
+		     slot = (slot + 1U) % PARTITION_INDEX_SLOTS) {
+			if (strcmp(list.list[name_index[slot] - 1U].name,
+				   list.list[i].name) == 0) {
+				break;
+			}
+		}
+		if (name_index[slot] == 0U) {
+			name_index[slot] = (uint8_t)(i + 1U);
+		}
+
+		for (slot = guid_hash(&list.list[i].part_guid);
+		     guid_index[slot] != 0U;
+		     slot = (slot + 1U) % PARTITION_INDEX_SLOTS) {
+			if (guidcmp(&list.list[guid_index[slot] - 1U].part_guid,
+				    &list.list[i].part_guid) == 0) {
+				break;
+			}
+		}
+		if (guid_index[slot] == 0U) {
+			guid_index[slot] = (uint8_t)(i + 1U);
+		}
+	}
+}
+
+/*
+ * Load the list of partitions from the MBR or from the primary GPT, falling
+ * back on the backup GPT.
+ */
+static int load_partition_list(unsigned int image_id)
 {
 	uintptr_t dev_handle, image_handle, image_spec = 0;
 	mbr_entry_t mbr_entry;
@@ -436,18 +506,41 @@ out:
 	return result;
 }
 
+/*
+ * Load the partition table info based on the image id provided.
+ */
+int load_partition_table(unsigned int image_id)
+{
+	int result;
+
+	/* Lookups fail until a table is successfully loaded */
+	zeromem(name_index, sizeof(name_index));
+	zeromem(guid_index, sizeof(guid_index));
+
+	result = load_partition_list(image_id);
+	if (result == 0) {
+		build_partition_index();
+	}
+
+	return result;
+}
+
 /*
  * Try retrieving a partition table entry based on the name of the partition.
  */
 const partition_entry_t *get_partition_entry(const char *name)
 {
-	unsigned int i;
-
-	for (i = 0U; i < list.entry_count; i++) {
-		if (strcmp(name, list.list[i].name) == 0) {
-			return &list.list[i];
+	unsigned int slot;
+	const partition_entry_t *entry;
+
+	for (slot = name_hash(name); name_index[slot] != 0U;
+	     slot = (slot + 1U) % PARTITION_INDEX_SLOTS) {
+		entry = &list.list[name_index[slot] - 1U];
+		if (strcmp(name, entry->name) == 0) {
+			return entry;
 		}
 	}
+
 	return NULL;
 }
 
@@ -474,11 +567,14 @@ const partition_entry_t *get_partition_entry_by_type(
 const partition_entry_t *get_partition_entry_by_guid(
 	const struct efi_guid *part_guid)
 {
-	unsigned int i;
-
-	for (i = 0U; i < list.entry_count; i++) {
-		if (guidcmp(part_guid, &list.list[i].part_guid) == 0) {
-			return &list.list[i];
+	unsigned int slot;
+	const partition_entry_t *entry;
+
+	for (slot = guid_hash(part_guid); guid_index[slot] != 0U;
+	     slot = (slot + 1U) % PARTITION_INDEX_SLOTS) {
+		entry = &list.list[guid_index[slot] - 1U];
+		if (guidcmp(part_guid, &entry->part_guid) == 0) {
+			return entry;
 		}
 	}
 
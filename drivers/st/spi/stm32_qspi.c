@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2022, STMicroelectronics - All Rights Reserved
+ * Copyright (c) 2019-2026, STMicroelectronics - All Rights Reserved
  *
  * SPDX-License-Identifier: GPL-2.0+ OR BSD-3-Clause
  */
@@ -238,9 +238,56 @@ static unsigned int stm32_qspi_get_mode(uint8_t buswidth)
 	return buswidth;
 }
 
-static int stm32_qspi_exec_op(const struct spi_mem_op *op)
+static uint32_t stm32_qspi_get_ccr(const struct spi_mem_op *op, uint8_t mode)
+{
+	uint32_t ccr;
+
+	ccr = mode << QSPI_CCR_FMODE_SHIFT;
+	ccr |= op->cmd.opcode;
+	ccr |= stm32_qspi_get_mode(op->cmd.buswidth) << QSPI_CCR_IMODE_SHIFT;
+
+	if (op->addr.nbytes != 0U) {
+		ccr |= (op->addr.nbytes - 1U) << QSPI_CCR_ADSIZE_SHIFT;
+		ccr |= stm32_qspi_get_mode(op->addr.buswidth) <<
+			QSPI_CCR_ADMODE_SHIFT;
+	}
+
+	if ((op->dummy.buswidth != 0U) && (op->dummy.nbytes != 0U)) {
+		ccr |= (op->dummy.nbytes * 8U / op->dummy.buswidth) <<
+			QSPI_CCR_DCYC_SHIFT;
+	}
+
+	if ((op->data.nbytes != 0U) || (mode == QSPI_CCR_MEM_MAP)) {
+		ccr |= stm32_qspi_get_mode(op->data.buswidth) <<
+			QSPI_CCR_DMODE_SHIFT;
+	}
+
+	return ccr;
+}
+
+static int stm32_qspi_abort(void)
 {
 	uint64_t timeout;
+	int ret = 0;
+
+	mmio_setbits_32(qspi_base() + QSPI_CR, QSPI_CR_ABORT);
+
+	/* Wait clear of abort bit by hardware */
+	timeout = timeout_init_us(QSPI_ABT_TIMEOUT_US);
+	while ((mmio_read_32(qspi_base() + QSPI_CR) & QSPI_CR_ABORT) != 0U) {
+		if (timeout_elapsed(timeout)) {
+			ret = -ETIMEDOUT;
+			break;
+		}
+	}
+
+	mmio_write_32(qspi_base() + QSPI_FCR, QSPI_FCR_CTCF);
+
+	return ret;
+}
+
+static int stm32_qspi_exec_op(const struct spi_mem_op *op)
+{
 	uint32_t ccr;
 	size_t addr_max;
 	uint8_t mode = QSPI_CCR_IND_WRITE;
@@ -266,25 +313,7 @@ static int stm32_qspi_exec_op(const struct spi_mem_op *op)
 		mmio_write_32(qspi_base() + QSPI_DLR, op->data.nbytes - 1U);
 	}
 
-	ccr = mode << QSPI_CCR_FMODE_SHIFT;
-	ccr |= op->cmd.opcode;
-	ccr |= stm32_qspi_get_mode(op->cmd.buswidth) << QSPI_CCR_IMODE_SHIFT;
-
-	if (op->addr.nbytes != 0U) {
-		ccr |= (op->addr.nbytes - 1U) << QSPI_CCR_ADSIZE_SHIFT;
-		ccr |= stm32_qspi_get_mode(op->addr.buswidth) <<
-			QSPI_CCR_ADMODE_SHIFT;
-	}
-
-	if ((op->dummy.buswidth != 0U) && (op->dummy.nbytes != 0U)) {
-		ccr |= (op->dummy.nbytes * 8U / op->dummy.buswidth) <<
-			QSPI_CCR_DCYC_SHIFT;
-	}
-
-	if (op->data.nbytes != 0U) {
-		ccr |= stm32_qspi_get_mode(op->data.buswidth) <<
-			QSPI_CCR_DMODE_SHIFT;
-	}
+	ccr = stm32_qspi_get_ccr(op, mode);
 
 	mmio_write_32(qspi_base() + QSPI_CCR, ccr);
 
@@ -314,19 +343,10 @@ static int stm32_qspi_exec_op(const struct spi_mem_op *op)
 	return 0;
 
 abort:
-	mmio_setbits_32(qspi_base() + QSPI_CR, QSPI_CR_ABORT);
-
-	/* Wait clear of abort bit by hardware */
-	timeout = timeout_init_us(QSPI_ABT_TIMEOUT_US);
-	while ((mmio_read_32(qspi_base() + QSPI_CR) & QSPI_CR_ABORT) != 0U) {
-		if (timeout_elapsed(timeout)) {
-			ret = -ETIMEDOUT;
-			break;
-		}
+	if (stm32_qspi_abort() != 0) {
+		ret = -ETIMEDOUT;
 	}
 
-	mmio_write_32(qspi_base() + QSPI_FCR, QSPI_FCR_CTCF);
-
 	if (ret != 0) {
 		ERROR("%s: exec op error\n", __func__);
 	}
@@ -436,12 +456,48 @@ static int stm32_qspi_set_mode(unsigned int mode)
 	return 0;
 }
 
+/*
+ * Leave the controller in memory-mapped mode: reads of the window are served
+ * with the operation, prefetching as the window is read sequentially.
+ */
+static int stm32_qspi_dirmap_enable(const struct spi_mem_op *op,
+				    uintptr_t *base, size_t *size)
+{
+	int ret;
+
+	if (op->data.dir != SPI_MEM_DATA_IN) {
+		return -ENOTSUP;
+	}
+
+	ret = stm32_qspi_wait_for_not_busy();
+	if (ret != 0) {
+		return ret;
+	}
+
+	mmio_write_32(qspi_base() + QSPI_CCR,
+		      stm32_qspi_get_ccr(op, QSPI_CCR_MEM_MAP));
+
+	*base = stm32_qspi.mm_base;
+	*size = stm32_qspi.mm_size;
+
+	return 0;
+}
+
+static void stm32_qspi_dirmap_disable(void)
+{
+	if (stm32_qspi_abort() != 0) {
+		ERROR("%s: abort timeout\n", __func__);
+	}
+}
+
 static const struct spi_bus_ops stm32_qspi_bus_ops = {
 	.claim_bus = stm32_qspi_claim_bus,
 	.release_bus = stm32_qspi_release_bus,
 	.set_speed = stm32_qspi_set_speed,
 	.set_mode = stm32_qspi_set_mode,
 	.exec_op = stm32_qspi_exec_op,
+	.dirmap_enable = stm32_qspi_dirmap_enable,
+	.dirmap_disable = stm32_qspi_dirmap_disable,
 };
 
 int stm32_qspi_init(void)
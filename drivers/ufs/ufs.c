@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -17,6 +17,7 @@
 #include <drivers/delay_timer.h>
 #include <drivers/ufs.h>
 #include <lib/mmio.h>
+#include <lib/utils_def.h>
 
 #define CDB_ADDR_MASK			127
 #define ALIGN_CDB(x)			(((x) + CDB_ADDR_MASK) & ~CDB_ADDR_MASK)
@@ -27,8 +28,33 @@
 
 #define MAX_PRDT_SIZE			0x40000		/* 256KB */
 
+/* Reads are not split across slots below this size */
+#define MIN_SPLIT_SIZE			0x10000		/* 64KB */
+
+/* Number of UTP Transfer Request Slots used for asynchronous reads */
+#ifndef UFS_MAX_SLOTS
+#define UFS_MAX_SLOTS			8
+#endif
+
+/*
+ * The descriptor area starts with the UTP Transfer Request List, which holds
+ * the UTRD of each slot. It is followed by the UTP Command Descriptor of each
+ * slot, made of the command UPIU, the response UPIU and the PRDT.
+ */
+#define UTRL_SIZE			UFS_DESC_SIZE
+
+/* Read queued in a slot by ufs_read_blocks() */
+typedef struct ufs_request {
+	utp_utrd_t	utrd;
+	cmd_info_t	cmd;
+	int		retries;
+} ufs_request_t;
+
 static ufs_params_t ufs_params;
 static int nutrs;	/* Number of UTP Transfer Request Slots */
+static size_t ucd_size;	/* Size of the UTP Command Descriptor of a slot */
+static ufs_request_t ufs_requests[UFS_MAX_SLOTS];
+static uint32_t ufs_slots_busy;	/* Slots holding a submitted request */
 
 /*
  * ufs_uic_error_handler - UIC error interrupts handler
@@ -373,35 +399,42 @@ static int ufshc_link_startup(uintptr_t base)
 	return -EIO;
 }
 
-/* Read Door Bell register to check if slot zero is available */
-static int is_slot_available(void)
+/* Read Door Bell register to check if a slot is available */
+static int is_slot_available(int slot)
 {
-	if (mmio_read_32(ufs_params.reg_base + UTRLDBR) & 0x1) {
+	if (mmio_read_32(ufs_params.reg_base + UTRLDBR) & (1U << slot)) {
 		return -EBUSY;
 	}
 	return 0;
 }
 
-static void get_utrd(utp_utrd_t *utrd)
+static uintptr_t get_ucd_base(int slot)
+{
+	return ufs_params.desc_base + UTRL_SIZE + (slot * ucd_size);
+}
+
+static void get_utrd(utp_utrd_t *utrd, int slot)
 {
 	uintptr_t base;
 	int result;
 	utrd_header_t *hd;
 
 	assert(utrd != NULL);
-	result = is_slot_available();
+	assert(slot < nutrs);
+	result = is_slot_available(slot);
 	assert(result == 0);
 
 	/* clear utrd */
 	memset((void *)utrd, 0, sizeof(utp_utrd_t));
-	base = ufs_params.desc_base;
-	/* clear the descriptor */
+	base = get_ucd_base(slot);
+	/* clear the descriptors */
+	utrd->header = ufs_params.desc_base + (slot * sizeof(utrd_header_t));
+	memset((void *)utrd->header, 0, sizeof(utrd_header_t));
 	memset((void *)base, 0, UFS_DESC_SIZE);
 
-	utrd->header = base;
-	utrd->task_tag = 1; /* We always use the first slot */
+	utrd->task_tag = slot + 1;
 	/* CDB address should be aligned with 128 bytes */
-	utrd->upiu = ALIGN_CDB(utrd->header + sizeof(utrd_header_t));
+	utrd->upiu = ALIGN_CDB(base);
 	utrd->resp_upiu = ALIGN_8(utrd->upiu + sizeof(cmd_upiu_t));
 	utrd->size_upiu = utrd->resp_upiu - utrd->upiu;
 	utrd->size_resp_upiu = ALIGN_8(sizeof(resp_upiu_t));
@@ -494,7 +527,7 @@ static int ufs_prepare_cmd(utp_utrd_t *utrd, uint8_t op, uint8_t lun,
 		assert(lba_cnt <= UINT16_MAX);
 		prdt = (prdt_t *)utrd->prdt;
 
-		desc_limit = ufs_params.desc_base + ufs_params.desc_size;
+		desc_limit = get_ucd_base(utrd->task_tag - 1) + ucd_size;
 		while (length > 0) {
 			if ((uintptr_t)prdt + sizeof(prdt_t) > desc_limit) {
 				ERROR("UFS: Exceeded descriptor limit. Image is too large\n");
@@ -519,7 +552,8 @@ static int ufs_prepare_cmd(utp_utrd_t *utrd, uint8_t op, uint8_t lun,
 	}
 
 	prdt_end = utrd->prdt + utrd->prdt_length * sizeof(prdt_t);
-	flush_dcache_range(utrd->header, prdt_end - utrd->header);
+	flush_dcache_range(utrd->header, sizeof(utrd_header_t));
+	flush_dcache_range(utrd->upiu, prdt_end - utrd->upiu);
 	return 0;
 }
 
@@ -572,7 +606,8 @@ static int ufs_prepare_query(utp_utrd_t *utrd, uint8_t op, uint8_t idn,
 		assert(0);
 		break;
 	}
-	flush_dcache_range((uintptr_t)utrd->header, UFS_DESC_SIZE);
+	flush_dcache_range(utrd->header, sizeof(utrd_header_t));
+	flush_dcache_range(utrd->upiu, UFS_DESC_SIZE);
 	return 0;
 }
 
@@ -590,7 +625,8 @@ static void ufs_prepare_nop_out(utp_utrd_t *utrd)
 
 	nop_out->trans_type = 0;
 	nop_out->task_tag = utrd->task_tag;
-	flush_dcache_range((uintptr_t)utrd->header, UFS_DESC_SIZE);
+	flush_dcache_range(utrd->header, sizeof(utrd_header_t));
+	flush_dcache_range(utrd->upiu, UFS_DESC_SIZE);
 }
 
 static void ufs_send_request(int task_tag)
@@ -598,6 +634,12 @@ static void ufs_send_request(int task_tag)
 	unsigned int data;
 	int slot;
 
+	/*
+	 * Synchronous requests use the interrupt status of the controller,
+	 * which is shared by all slots.
+	 */
+	assert(ufs_slots_busy == 0U);
+
 	slot = task_tag - 1;
 	/* clear all interrupts */
 	mmio_write_32(ufs_params.reg_base + IS, ~0);
@@ -612,32 +654,23 @@ static void ufs_send_request(int task_tag)
 	mmio_setbits_32(ufs_params.reg_base + UTRLDBR, 1U << slot);
 }
 
-static int ufs_check_resp(utp_utrd_t *utrd, int trans_type, unsigned int timeout_ms)
+/* Check the response of a completed request */
+static int ufs_get_resp(utp_utrd_t *utrd, int trans_type)
 {
 	utrd_header_t *hd;
 	resp_upiu_t *resp;
 	sense_data_t *sense;
-	unsigned int data;
-	int slot, result;
 
 	hd = (utrd_header_t *)utrd->header;
 	resp = (resp_upiu_t *)utrd->resp_upiu;
 
-	result = ufs_wait_for_int_status(UFS_INT_UTRCS, timeout_ms, false);
-	if (result != 0) {
-		return result;
-	}
-
-	slot = utrd->task_tag - 1;
-
-	data = mmio_read_32(ufs_params.reg_base + UTRLDBR);
-	assert((data & (1 << slot)) == 0);
 	/*
 	 * Invalidate the header after DMA read operation has
 	 * completed to avoid cpu referring to the prefetched
 	 * data brought in before DMA completion.
 	 */
-	inv_dcache_range((uintptr_t)hd, UFS_DESC_SIZE);
+	inv_dcache_range(utrd->header, sizeof(utrd_header_t));
+	inv_dcache_range(utrd->upiu, UFS_DESC_SIZE);
 	assert(hd->ocs == OCS_SUCCESS);
 	assert((resp->trans_type & TRANS_TYPE_CODE_MASK) == trans_type);
 
@@ -649,10 +682,28 @@ static int ufs_check_resp(utp_utrd_t *utrd, int trans_type, unsigned int timeout
 		return -EAGAIN;
 	}
 
-	(void)resp;
+	(void)hd;
+	return 0;
+}
+
+static int ufs_check_resp(utp_utrd_t *utrd, int trans_type, unsigned int timeout_ms)
+{
+	unsigned int data;
+	int slot, result;
+
+	result = ufs_wait_for_int_status(UFS_INT_UTRCS, timeout_ms, false);
+	if (result != 0) {
+		return result;
+	}
+
+	slot = utrd->task_tag - 1;
+
+	data = mmio_read_32(ufs_params.reg_base + UTRLDBR);
+	assert((data & (1 << slot)) == 0);
+
 	(void)slot;
 	(void)data;
-	return 0;
+	return ufs_get_resp(utrd, trans_type);
 }
 
 static void ufs_send_cmd(utp_utrd_t *utrd, uint8_t cmd_op, uint8_t lun, int lba, uintptr_t buf,
@@ -661,7 +712,7 @@ static void ufs_send_cmd(utp_utrd_t *utrd, uint8_t cmd_op, uint8_t lun, int lba,
 	int result, i;
 
 	for (i = 0; i < UFS_CMD_RETRIES; ++i) {
-		get_utrd(utrd);
+		get_utrd(utrd, 0);
 		result = ufs_prepare_cmd(utrd, cmd_op, lun, lba, buf, length);
 		assert(result == 0);
 		ufs_send_request(utrd->task_tag);
@@ -713,7 +764,7 @@ static void ufs_verify_init(void)
 	utp_utrd_t utrd;
 	int result;
 
-	get_utrd(&utrd);
+	get_utrd(&utrd, 0);
 	ufs_prepare_nop_out(&utrd);
 	ufs_send_request(utrd.task_tag);
 	result = ufs_check_resp(&utrd, NOP_IN_UPIU, NOP_OUT_TIMEOUT_MS);
@@ -746,7 +797,7 @@ static void ufs_query(uint8_t op, uint8_t idn, uint8_t index, uint8_t sel,
 		/* Do nothing in default case */
 		break;
 	}
-	get_utrd(&utrd);
+	get_utrd(&utrd, 0);
 	ufs_prepare_query(&utrd, op, idn, index, sel, buf, size);
 	ufs_send_request(utrd.task_tag);
 	result = ufs_check_resp(&utrd, QUERY_RESPONSE_UPIU, QUERY_REQ_TIMEOUT_MS);
@@ -831,7 +882,7 @@ static int ufs_read_capacity(int lun, unsigned int *num, unsigned int *size)
 
 	assert((ufs_params.reg_base != 0) &&
 	       (ufs_params.desc_base != 0) &&
-	       (ufs_params.desc_size >= UFS_DESC_SIZE) &&
+	       (ufs_params.desc_size >= (UTRL_SIZE + UFS_DESC_SIZE)) &&
 	       (num != NULL) && (size != NULL));
 
 	/* align buf address */
@@ -865,26 +916,234 @@ static int ufs_read_capacity(int lun, unsigned int *num, unsigned int *size)
 	return -ETIMEDOUT;
 }
 
-size_t ufs_read_blocks(int lun, int lba, uintptr_t buf, size_t size)
+/* Build the descriptors of the request held by a slot, without sending it */
+static void ufs_prepare_request(int slot)
 {
-	utp_utrd_t utrd;
+	ufs_request_t *req = &ufs_requests[slot];
+	int result;
+
+	get_utrd(&req->utrd, slot);
+	result = ufs_prepare_cmd(&req->utrd, req->cmd.op, req->cmd.lun,
+				 req->cmd.lba, req->cmd.buf, req->cmd.length);
+	assert(result == 0);
+	(void)result;
+}
+
+/* Reserve a slot for a read, the caller rings its doorbell */
+static void ufs_queue_read(int slot, int lun, int lba, uintptr_t buf,
+			   size_t size)
+{
+	ufs_request_t *req = &ufs_requests[slot];
+
+	req->cmd.buf = buf;
+	req->cmd.length = size;
+	req->cmd.lba = lba;
+	req->cmd.op = CDBCMD_READ_10;
+	req->cmd.lun = lun;
+	req->retries = 0;
+
+	ufs_slots_busy |= 1U << slot;
+	ufs_prepare_request(slot);
+}
+
+/*
+ * Largest read a single command can carry: READ(10) transfers at most
+ * UINT16_MAX blocks, and the PRDT must fit in the command descriptor.
+ */
+static size_t ufs_max_read_size(void)
+{
+	size_t prdt_offset = ALIGN_8(sizeof(cmd_upiu_t)) +
+			     ALIGN_8(sizeof(resp_upiu_t));
+	size_t max_prdt = ((ucd_size - prdt_offset) / sizeof(prdt_t)) *
+			  MAX_PRDT_SIZE;
+
+	return MIN(max_prdt, (size_t)UINT16_MAX << UFS_BLOCK_SHIFT);
+}
+
+/*
+ * Check whether the request identified by tag has completed. On completion
+ * the slot is released and the number of bytes transferred is returned in
+ * length.
+ * Return 0 on completion, -EINPROGRESS if the request is still in progress,
+ * another negative error code if it failed.
+ */
+static int ufs_request_poll(int tag, size_t *length)
+{
+	ufs_request_t *req;
 	resp_upiu_t *resp;
+	uint32_t status;
+	int result;
 
-	assert((ufs_params.reg_base != 0) &&
-	       (ufs_params.desc_base != 0) &&
-	       (ufs_params.desc_size >= UFS_DESC_SIZE));
+	assert((tag >= 0) && (tag < nutrs) && (length != NULL));
+	assert((ufs_slots_busy & (1U << tag)) != 0U);
+
+	req = &ufs_requests[tag];
+
+	status = mmio_read_32(ufs_params.reg_base + IS) &
+		 mmio_read_32(ufs_params.reg_base + IE);
+	if ((status & UFS_INT_ERR) != 0U) {
+		mmio_write_32(ufs_params.reg_base + IS, status & UFS_INT_ERR);
+		result = ufs_error_handler(status, false);
+		if (result != 0) {
+			ufs_slots_busy &= ~(1U << tag);
+			return result;
+		}
+	}
+
+	if (is_slot_available(tag) != 0) {
+		return -EINPROGRESS;
+	}
+
+	result = ufs_get_resp(&req->utrd, RESPONSE_UPIU);
+	if ((result == -EAGAIN) && (++req->retries < UFS_CMD_RETRIES)) {
+		ufs_prepare_request(tag);
+		mmio_write_32(ufs_params.reg_base + UTRLDBR, 1U << tag);
+		return -EINPROGRESS;
+	}
+
+	ufs_slots_busy &= ~(1U << tag);
+	if (ufs_slots_busy == 0U) {
+		/* Completions are counted by the controller, drop them */
+		mmio_write_32(ufs_params.reg_base + IS, UFS_INT_UTRCS);
+	}
+
+	if (result != 0) {
+		return result;
+	}
 
-	ufs_send_cmd(&utrd, CDBCMD_READ_10, lun, lba, buf, size);
 #ifdef UFS_RESP_DEBUG
-	dump_upiu(&utrd);
+	dump_upiu(&req->utrd);
 #endif
 	/*
 	 * Invalidate prefetched cache contents before cpu
 	 * accesses the buf.
 	 */
-	inv_dcache_range(buf, size);
-	resp = (resp_upiu_t *)utrd.resp_upiu;
-	return size - resp->res_trans_cnt;
+	inv_dcache_range(req->cmd.buf, req->cmd.length);
+	resp = (resp_upiu_t *)req->utrd.resp_upiu;
+	*length = req->cmd.length - resp->res_trans_cnt;
+
+	return 0;
+}
+
+/*
+ * Abort the requests queued in the slots of mask: clear their doorbells so that
+ * the controller stops transferring data, and release the slots once it has.
+ * Slots the controller fails to clear are kept busy, as their buffers may
+ * still be written.
+ * Return 0 on success, -ETIMEDOUT if the doorbells were not cleared.
+ */
+static int ufs_abort_requests(uint32_t mask)
+{
+	uint64_t timeout;
+
+	/* Writing 0 to a bit of UTRLCLR clears the matching doorbell */
+	mmio_write_32(ufs_params.reg_base + UTRLCLR, ~mask);
+
+	timeout = timeout_init_us(CMD_TIMEOUT_MS * 1000U);
+	while ((mmio_read_32(ufs_params.reg_base + UTRLDBR) & mask) != 0U) {
+		if (timeout_elapsed(timeout)) {
+			ERROR("UFS: failed to clear slots 0x%x\n", mask);
+			return -ETIMEDOUT;
+		}
+	}
+
+	ufs_slots_busy &= ~mask;
+	if (ufs_slots_busy == 0U) {
+		/* Completions are counted by the controller, drop them */
+		mmio_write_32(ufs_params.reg_base + IS, UFS_INT_UTRCS);
+	}
+
+	return 0;
+}
+
+/*
+ * Read size bytes from block lba of lun into buf. Large reads are split into
+ * several commands, queued in the free slots and submitted together so that
+ * the device can work on them concurrently. Slots are refilled as their
+ * commands complete.
+ * Return the number of bytes read, 0 on error.
+ */
+size_t ufs_read_blocks(int lun, int lba, uintptr_t buf, size_t size)
+{
+	uint64_t timeout = 0ULL;
+	uint32_t pending = 0U;
+	uint32_t batch, done;
+	size_t chunk, length, total = 0U;
+	int slot, result;
+	bool failed = false;
+
+	assert((ufs_params.reg_base != 0) &&
+	       (ufs_params.desc_base != 0) &&
+	       (ufs_params.desc_size >= (UTRL_SIZE + UFS_DESC_SIZE)));
+
+	chunk = round_up(div_round_up(size, (size_t)nutrs), UFS_BLOCK_SIZE);
+	chunk = MIN(MAX(chunk, (size_t)MIN_SPLIT_SIZE), ufs_max_read_size());
+
+	while ((size > 0U) || (pending != 0U)) {
+		batch = 0U;
+		for (slot = 0; (slot < nutrs) && (size > 0U); slot++) {
+			if ((ufs_slots_busy & (1U << slot)) != 0U) {
+				continue;
+			}
+
+			length = MIN(chunk, size);
+			ufs_queue_read(slot, lun, lba, buf, length);
+			batch |= 1U << slot;
+
+			lba += length >> UFS_BLOCK_SHIFT;
+			buf += length;
+			size -= length;
+		}
+
+		if (batch != 0U) {
+			/* Writing 0 to a doorbell bit has no effect */
+			mmio_write_32(ufs_params.reg_base + UTRLDBR, batch);
+			pending |= batch;
+			timeout = timeout_init_us(CMD_TIMEOUT_MS * 1000U);
+		}
+
+		if (pending == 0U) {
+			/* All slots are held by requests that failed to abort */
+			ERROR("UFS: no slot available\n");
+			return 0U;
+		}
+
+		/* Wait for at least one of the pending commands to complete */
+		do {
+			done = pending &
+			       ~mmio_read_32(ufs_params.reg_base + UTRLDBR);
+			if (timeout_elapsed(timeout)) {
+				ERROR("UFS: read timed out\n");
+				(void)ufs_abort_requests(pending);
+				return 0U;
+			}
+		} while (done == 0U);
+
+		for (slot = 0; done != 0U; slot++, done >>= 1) {
+			if ((done & 1U) == 0U) {
+				continue;
+			}
+
+			result = ufs_request_poll(slot, &length);
+			if (result == -EINPROGRESS) {
+				/* Resubmitted after a unit attention */
+				continue;
+			}
+
+			pending &= ~(1U << slot);
+			if ((result != 0) ||
+			    (length != ufs_requests[slot].cmd.length)) {
+				/* Stop queueing, let the others complete */
+				failed = true;
+				size = 0U;
+				continue;
+			}
+
+			total += length;
+		}
+	}
+
+	return failed ? 0U : total;
 }
 
 size_t ufs_write_blocks(int lun, int lba, const uintptr_t buf, size_t size)
@@ -894,7 +1153,7 @@ size_t ufs_write_blocks(int lun, int lba, const uintptr_t buf, size_t size)
 
 	assert((ufs_params.reg_base != 0) &&
 	       (ufs_params.desc_base != 0) &&
-	       (ufs_params.desc_size >= UFS_DESC_SIZE));
+	       (ufs_params.desc_size >= (UTRL_SIZE + UFS_DESC_SIZE)));
 
 	ufs_send_cmd(&utrd, CDBCMD_WRITE_10, lun, lba, buf, size);
 #ifdef UFS_RESP_DEBUG
@@ -986,15 +1245,20 @@ int ufs_init(const ufs_ops_t *ops, ufs_params_t *params)
 	assert((params != NULL) &&
 	       (params->reg_base != 0) &&
 	       (params->desc_base != 0) &&
-	       (params->desc_size >= UFS_DESC_SIZE));
+	       (params->desc_size >= (UTRL_SIZE + UFS_DESC_SIZE)));
 
 	memcpy(&ufs_params, params, sizeof(ufs_params_t));
 
 	/* 0 means 1 slot */
 	nutrs = (mmio_read_32(ufs_params.reg_base + CAP) & CAP_NUTRS_MASK) + 1;
-	if (nutrs > (ufs_params.desc_size / UFS_DESC_SIZE)) {
-		nutrs = ufs_params.desc_size / UFS_DESC_SIZE;
+	if (nutrs > UFS_MAX_SLOTS) {
+		nutrs = UFS_MAX_SLOTS;
+	}
+	if (nutrs > ((ufs_params.desc_size - UTRL_SIZE) / UFS_DESC_SIZE)) {
+		nutrs = (ufs_params.desc_size - UTRL_SIZE) / UFS_DESC_SIZE;
 	}
+	/* Share the space after the UTRL between the command descriptors */
+	ucd_size = ((ufs_params.desc_size - UTRL_SIZE) / nutrs) & ~CDB_ADDR_MASK;
 
 
 	if (ufs_params.flags & UFS_FLAGS_SKIPINIT) {
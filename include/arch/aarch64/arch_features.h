@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2024, Arm Limited. All rights reserved.
+ * Copyright (c) 2019-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -84,6 +84,8 @@ CREATE_FEATURE_SUPPORTED(name, is_ ## name ## _present, guard)
  * +----------------------------+
  * |	FEAT_RNG		|
  * +----------------------------+
+ * |	FEAT_SHA256/SHA512	|
+ * +----------------------------+
  * |	FEAT_TCR2		|
  * +----------------------------+
  * |	FEAT_S2POE		|
@@ -236,6 +238,13 @@ CREATE_FEATURE_FUNCS(feat_ecv_v2, id_aa64mmfr0_el1, ID_AA64MMFR0_EL1_ECV_SHIFT,
 CREATE_FEATURE_FUNCS(feat_rng, id_aa64isar0_el1, ID_AA64ISAR0_RNDR_SHIFT,
 		     ID_AA64ISAR0_RNDR_MASK, 1U, ENABLE_FEAT_RNG)
 
+/* FEAT_SHA256 and FEAT_SHA512: SHA-2 instructions */
+CREATE_FEATURE_FUNCS(feat_sha256, id_aa64isar0_el1, ID_AA64ISAR0_SHA2_SHIFT,
+		     ID_AA64ISAR0_SHA2_MASK, 1U, ENABLE_FEAT_SHA256)
+CREATE_FEATURE_FUNCS(feat_sha512, id_aa64isar0_el1, ID_AA64ISAR0_SHA2_SHIFT,
+		     ID_AA64ISAR0_SHA2_MASK, SHA2_SHA512_IMPLEMENTED,
+		     ENABLE_FEAT_SHA512)
+
 /* FEAT_TCR2: Support TCR2_ELx regs */
 CREATE_FEATURE_FUNCS(feat_tcr2, id_aa64mmfr3_el1, ID_AA64MMFR3_EL1_TCRX_SHIFT,
 		     ID_AA64MMFR3_EL1_TCRX_MASK, 1U, ENABLE_FEAT_TCR2)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -171,6 +171,11 @@ typedef struct meminfo {
  * Function & variable prototypes
  ******************************************************************************/
 int load_auth_image(unsigned int image_id, image_info_t *image_data);
+#if BL2_PARALLEL_AUTH && defined(IMAGE_BL2)
+int load_image_auth_parents(unsigned int image_id, image_info_t *image_data);
+int auth_loaded_image(unsigned int image_id, const image_info_t *image_data);
+int measure_loaded_image(unsigned int image_id, image_info_t *image_data);
+#endif
 
 #if TRUSTED_BOARD_BOOT && defined(DYN_DISABLE_AUTH)
 /*
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -79,6 +79,19 @@ typedef struct crypto_lib_desc_s {
 			    unsigned int key_flags, const void *iv,
 			    unsigned int iv_len, const void *tag,
 			    unsigned int tag_len);
+
+	/*
+	 * Verify a hash over data provided in several chunks (optional). Only
+	 * one such verification can be in progress at a time, starting a new
+	 * one cancels the previous one. Return one of the
+	 * 'enum crypto_ret_value' options. verify_hash_abort() releases the
+	 * resources of a verification that is not finished.
+	 */
+	int (*verify_hash_start)(void *digest_info_ptr,
+				 unsigned int digest_info_len);
+	int (*verify_hash_update)(const void *data_ptr, unsigned int data_len);
+	int (*verify_hash_finish)(void);
+	void (*verify_hash_abort)(void);
 } crypto_lib_desc_t;
 
 /* Public functions */
@@ -98,6 +111,11 @@ int crypto_mod_verify_signature(void *data_ptr, unsigned int data_len,
 				void *pk_ptr, unsigned int pk_len);
 int crypto_mod_verify_hash(void *data_ptr, unsigned int data_len,
 			   void *digest_info_ptr, unsigned int digest_info_len);
+int crypto_mod_verify_hash_start(void *digest_info_ptr,
+				 unsigned int digest_info_len);
+int crypto_mod_verify_hash_update(const void *data_ptr, unsigned int data_len);
+int crypto_mod_verify_hash_finish(void);
+void crypto_mod_verify_hash_abort(void);
 #endif /* (CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_ONLY) || \
 	  (CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_AND_HASH_CALC) */
 
@@ -121,6 +139,22 @@ int crypto_mod_convert_pk(void *full_pk_ptr, unsigned int full_pk_len,
 /* Macro to register a cryptographic library */
 #define REGISTER_CRYPTO_LIB(_name, _init, _verify_signature, _verify_hash, \
 			    _calc_hash, _auth_decrypt, _convert_pk) \
+	REGISTER_CRYPTO_LIB_HASH_STREAM(_name, _init, _verify_signature, \
+					_verify_hash, _calc_hash, \
+					_auth_decrypt, _convert_pk, \
+					NULL, NULL, NULL, NULL)
+
+/*
+ * Macro to register a cryptographic library which can also verify a hash over
+ * data provided in several chunks
+ */
+#define REGISTER_CRYPTO_LIB_HASH_STREAM(_name, _init, _verify_signature, \
+					_verify_hash, _calc_hash, \
+					_auth_decrypt, _convert_pk, \
+					_verify_hash_start, \
+					_verify_hash_update, \
+					_verify_hash_finish, \
+					_verify_hash_abort) \
 	const crypto_lib_desc_t crypto_lib_desc = { \
 		.name = _name, \
 		.init = _init, \
@@ -128,7 +162,11 @@ int crypto_mod_convert_pk(void *full_pk_ptr, unsigned int full_pk_len,
 		.verify_hash = _verify_hash, \
 		.calc_hash = _calc_hash, \
 		.auth_decrypt = _auth_decrypt, \
-		.convert_pk = _convert_pk \
+		.convert_pk = _convert_pk, \
+		.verify_hash_start = _verify_hash_start, \
+		.verify_hash_update = _verify_hash_update, \
+		.verify_hash_finish = _verify_hash_finish, \
+		.verify_hash_abort = _verify_hash_abort \
 	}
 
 extern const crypto_lib_desc_t crypto_lib_desc;
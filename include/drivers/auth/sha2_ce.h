@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef SHA2_CE_H
+#define SHA2_CE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <drivers/auth/crypto_mod.h>
+
+/* SHA-2 computation using the FEAT_SHA256 and FEAT_SHA512 instructions */
+typedef struct sha2_ce_ctx {
+	union {
+		uint32_t s256[8];
+		uint64_t s512[8];
+	} state;
+	uint8_t buf[128];
+	size_t buf_len;
+	uint64_t total_len;
+	enum crypto_md_algo algo;
+} sha2_ce_ctx_t;
+
+bool sha2_ce_supported(enum crypto_md_algo algo);
+unsigned int sha2_ce_size(enum crypto_md_algo algo);
+void sha2_ce_start(sha2_ce_ctx_t *ctx, enum crypto_md_algo algo);
+void sha2_ce_update(sha2_ce_ctx_t *ctx, const void *data, size_t len);
+void sha2_ce_finish(sha2_ce_ctx_t *ctx, uint8_t *output);
+void sha2_ce_calc(enum crypto_md_algo algo, const void *data, size_t len,
+		  uint8_t *output);
+
+#endif /* SHA2_CE_H */
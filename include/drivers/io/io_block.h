@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2016-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -7,6 +7,8 @@
 #ifndef IO_BLOCK_H
 #define IO_BLOCK_H
 
+#include <stdbool.h>
+
 #include <drivers/io/io_storage.h>
 
 /* block devices ops */
@@ -19,6 +21,12 @@ typedef struct io_block_dev_spec {
 	io_block_spec_t	buffer;
 	io_block_ops_t	ops;
 	size_t		block_size;
+	/*
+	 * Set if the ops can transfer data to and from any block-aligned
+	 * address, so that whole blocks are transferred straight to the
+	 * caller's buffer rather than through the bounce buffer above.
+	 */
+	bool		direct_io;
 } io_block_dev_spec_t;
 
 struct io_dev_connector;
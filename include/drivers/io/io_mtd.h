@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2019-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -54,6 +54,23 @@ typedef struct io_mtd_ops {
 	 * Return 0 on success, a negative error code otherwise.
 	 */
 	int (*seek)(uintptr_t base, unsigned int offset, size_t *extra_offset);
+
+	/*
+	 * Map the device in a memory-mapped window, reads covered by the
+	 * window are then done with the CPU instead of read(). The window is
+	 * enabled when a file is opened and disabled when it is closed, both
+	 * dirmap_enable() and dirmap_disable() must be set to use it.
+	 *
+	 * @base: [out] Base address of the window.
+	 * @size: [out] Size in bytes of the device area mapped in the window.
+	 * Return 0 on success, a negative error code otherwise.
+	 */
+	int (*dirmap_enable)(uintptr_t *base, size_t *size);
+
+	/*
+	 * Disable the memory-mapped window enabled with dirmap_enable().
+	 */
+	void (*dirmap_disable)(void);
 } io_mtd_ops_t;
 
 typedef struct io_mtd_dev_spec {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2021-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -14,6 +14,8 @@
 #define MMC_BLOCK_SIZE			U(512)
 #define MMC_BLOCK_MASK			(MMC_BLOCK_SIZE - U(1))
 #define MMC_BOOT_CLK_RATE		(400 * 1000)
+#define MMC_HS_MAX_FREQ			U(52000000)
+#define MMC_HS200_MAX_FREQ		U(200000000)
 
 #define MMC_CMD(_x)			U(_x)
 
@@ -60,6 +62,7 @@
 #define CMD_EXTCSD_PARTITION_CONFIG	179
 #define CMD_EXTCSD_BUS_WIDTH		183
 #define CMD_EXTCSD_HS_TIMING		185
+#define CMD_EXTCSD_DEVICE_TYPE		196
 #define CMD_EXTCSD_PART_SWITCH_TIME	199
 #define CMD_EXTCSD_SEC_CNT		212
 #define CMD_EXTCSD_BOOT_SIZE_MULT	226
@@ -73,6 +76,10 @@
 #define PART_CFG_CURRENT_BOOT_PARTITION(x)	(((x) & PART_CFG_BOOT_PART_EN_MASK) >> \
 	PART_CFG_BOOT_PART_EN_SHIFT)
 
+#define EXT_CSD_DEVICE_TYPE_HS_52	BIT(1)
+#define EXT_CSD_DEVICE_TYPE_HS200	(BIT(4) | BIT(5))
+#define EXT_CSD_DEVICE_TYPE_HS400	(BIT(6) | BIT(7))
+
 /* Values in EXT CSD register */
 #define MMC_BUS_WIDTH_1			U(0)
 #define MMC_BUS_WIDTH_4			U(1)
@@ -82,6 +89,10 @@
 #define MMC_BOOT_MODE_BACKWARD		(U(0) << 3)
 #define MMC_BOOT_MODE_HS_TIMING		(U(1) << 3)
 #define MMC_BOOT_MODE_DDR		(U(2) << 3)
+#define MMC_TIMING_BACKWARD		U(0)
+#define MMC_TIMING_HS			U(1)
+#define MMC_TIMING_HS200		U(2)
+#define MMC_TIMING_HS400		U(3)
 
 #define EXTCSD_SET_CMD			(U(0) << 24)
 #define EXTCSD_SET_BITS			(U(1) << 24)
@@ -138,6 +149,9 @@ struct mmc_ops {
 	int (*prepare)(int lba, uintptr_t buf, size_t size);
 	int (*read)(int lba, uintptr_t buf, size_t size);
 	int (*write)(int lba, const uintptr_t buf, size_t size);
+	/* Optional, needed for HS200 and HS400 */
+	int (*set_timing)(unsigned int timing, unsigned int clk);
+	int (*execute_tuning)(unsigned int cmd_idx);
 };
 
 struct mmc_csd_emmc {
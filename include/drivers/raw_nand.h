@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, STMicroelectronics - All Rights Reserved
+ * Copyright (c) 2019-2026, STMicroelectronics - All Rights Reserved
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -8,6 +8,7 @@
 #define DRIVERS_RAW_NAND_H
 
 #include <cdefs.h>
+#include <stdbool.h>
 #include <stdint.h>
 
 #include <drivers/nand.h>
@@ -33,6 +34,7 @@
 #define NAND_TIR_MIN			10000UL
 #define NAND_TITC_MIN			1000000UL
 #define NAND_TR_MAX			200000000UL
+#define NAND_TRCBSY_MAX			NAND_TR_MAX
 #define NAND_TRC_MIN			100000UL
 #define NAND_TREA_MAX			40000UL
 #define NAND_TREH_MIN			30000UL
@@ -66,6 +68,8 @@
 #define NAND_CMD_CHANGE_1ST		0x05U
 #define NAND_CMD_READID_SIG_ADDR	0x20U
 #define NAND_CMD_READ_2ND		0x30U
+#define NAND_CMD_READ_CACHE_SEQ		0x31U
+#define NAND_CMD_READ_CACHE_END		0x3FU
 #define NAND_CMD_STATUS			0x70U
 #define NAND_CMD_READID			0x90U
 #define NAND_CMD_CHANGE_2ND		0xE0U
@@ -75,6 +79,7 @@
 #define ONFI_REV_21			BIT(3)
 #define ONFI_FEAT_BUS_WIDTH_16		BIT(0)
 #define ONFI_FEAT_EXTENDED_PARAM	BIT(7)
+#define ONFI_OPT_CMD_READ_CACHE		BIT(1)
 
 /* NAND ECC type */
 #define NAND_ECC_NONE			U(0)
@@ -166,6 +171,7 @@ struct nand_ctrl_ops {
 struct rawnand_device {
 	struct nand_device *nand_dev;
 	const struct nand_ctrl_ops *ops;
+	bool cache_read; /* Device supports the read cache commands */
 };
 
 int nand_raw_init(unsigned long long *size, unsigned int *erase_size);
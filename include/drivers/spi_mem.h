@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, STMicroelectronics - All Rights Reserved
+ * Copyright (c) 2019-2026, STMicroelectronics - All Rights Reserved
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -121,9 +121,31 @@ struct spi_bus_ops {
 	 * Returns: 0 on success, a negative error code otherwise.
 	 */
 	int (*exec_op)(const struct spi_mem_op *op);
+
+	/*
+	 * Optional: map the memory in the controller memory-mapped window.
+	 * The bus is claimed while the mapping is enabled.
+	 *
+	 * @op:	Read operation used for accesses to the window, its address
+	 *	value and data length are ignored.
+	 * @base: [out] Base address of the window.
+	 * @size: [out] Size of the window in bytes.
+	 * Returns: 0 on success, a negative error code otherwise.
+	 */
+	int (*dirmap_enable)(const struct spi_mem_op *op, uintptr_t *base,
+			     size_t *size);
+
+	/*
+	 * Optional: leave memory-mapped mode.
+	 */
+	void (*dirmap_disable)(void);
 };
 
+bool spi_mem_supports_op(const struct spi_mem_op *op);
 int spi_mem_exec_op(const struct spi_mem_op *op);
+int spi_mem_dirmap_enable(const struct spi_mem_op *op, uintptr_t *base,
+			  size_t *size);
+void spi_mem_dirmap_disable(void);
 int spi_mem_init_slave(void *fdt, int bus_node,
 		       const struct spi_bus_ops *ops);
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, STMicroelectronics - All Rights Reserved
+ * Copyright (c) 2019-2026, STMicroelectronics - All Rights Reserved
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -16,6 +16,7 @@
 #define SPI_NOR_OP_READ_CR	0x35U	/* Read configuration register */
 #define SPI_NOR_OP_READ_SR	0x05U	/* Read status register */
 #define SPI_NOR_OP_READ_FSR	0x70U	/* Read flag status register */
+#define SPI_NOR_OP_READ_SFDP	0x5AU	/* Read SFDP parameters */
 #define SPINOR_OP_RDEAR		0xC8U	/* Read Extended Address Register */
 #define SPINOR_OP_WREAR		0xC5U	/* Write Extended Address Register */
 
@@ -33,10 +34,11 @@
 /* Flags for NOR specific configuration */
 #define SPI_NOR_USE_FSR		BIT(0)
 #define SPI_NOR_USE_BANK	BIT(1)
+#define SPI_NOR_NO_SFDP		BIT(2)	/* Keep the platform read_op */
 
 struct nor_device {
 	struct spi_mem_op read_op;
-	uint32_t size;
+	unsigned long long size;
 	uint32_t flags;
 	uint8_t selected_bank;
 	uint8_t bank_write_cmd;
@@ -46,6 +48,8 @@ struct nor_device {
 int spi_nor_read(unsigned int offset, uintptr_t buffer, size_t length,
 		 size_t *length_read);
 int spi_nor_init(unsigned long long *device_size, unsigned int *erase_size);
+int spi_nor_dirmap_enable(uintptr_t *base, size_t *size);
+void spi_nor_dirmap_disable(void);
 
 /*
  * Platform can implement this to override default NOR instance configuration.
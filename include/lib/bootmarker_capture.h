@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2023-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -13,7 +13,9 @@
 #define BL2_EXIT	U(3)
 #define BL31_ENTRY	U(4)
 #define BL31_EXIT	U(5)
-#define BL_TOTAL_IDS	U(6)
+#define BL2_LOAD_DONE	U(6)	/* All images loaded by BL2 */
+#define BL2_AUTH_DONE	U(7)	/* All images authenticated by BL2 */
+#define BL_TOTAL_IDS	U(8)
 
 #ifdef __ASSEMBLER__
 PMF_DECLARE_CAPTURE_TIMESTAMP(bl_svc)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -55,6 +55,14 @@ void cm_el1_sysregs_context_save(uint32_t security_state);
 void cm_el1_sysregs_context_restore(uint32_t security_state);
 #endif /* (CTX_INCLUDE_EL2_REGS && IMAGE_BL31) */
 
+#if (CTX_EL2_LAZY_RESTORE && IMAGE_BL31)
+void cm_el2_sysregs_live_invalidate(void);
+#else
+static inline void cm_el2_sysregs_live_invalidate(void)
+{
+}
+#endif /* (CTX_EL2_LAZY_RESTORE && IMAGE_BL31) */
+
 void cm_set_elr_el3(uint32_t security_state, uintptr_t entrypoint);
 void cm_set_elr_spsr_el3(uint32_t security_state,
 			uintptr_t entrypoint, uint32_t spsr);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2014-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -59,8 +59,16 @@
 #define CPU_DATA_CRASH_BUF_END		CPU_DATA_CRASH_BUF_OFFSET
 #endif
 
+#if defined(IMAGE_BL31) && CTX_EL2_LAZY_RESTORE
+/* Offset of the el2_sysregs_live pointer, size 8 bytes */
+#define CPU_DATA_EL2_LIVE_OFFSET	CPU_DATA_CRASH_BUF_END
+#define CPU_DATA_EL2_LIVE_END		(CPU_DATA_EL2_LIVE_OFFSET + 8)
+#else
+#define CPU_DATA_EL2_LIVE_END		CPU_DATA_CRASH_BUF_END
+#endif
+
 /* cpu_data size is the data size rounded up to the platform cache line size */
-#define CPU_DATA_SIZE			(((CPU_DATA_CRASH_BUF_END + \
+#define CPU_DATA_SIZE			(((CPU_DATA_EL2_LIVE_END + \
 					CACHE_WRITEBACK_GRANULE - 1) / \
 						CACHE_WRITEBACK_GRANULE) * \
 							CACHE_WRITEBACK_GRANULE)
@@ -68,7 +76,7 @@
 #if ENABLE_RUNTIME_INSTRUMENTATION
 /* Temporary space to store PMF timestamps from assembly code */
 #define CPU_DATA_PMF_TS_COUNT		1
-#define CPU_DATA_PMF_TS0_OFFSET		CPU_DATA_CRASH_BUF_END
+#define CPU_DATA_PMF_TS0_OFFSET		CPU_DATA_EL2_LIVE_END
 #define CPU_DATA_PMF_TS0_IDX		0
 #endif
 
@@ -128,6 +136,10 @@ typedef struct cpu_data {
 #if CRASH_REPORTING
 	u_register_t crash_buf[CPU_DATA_CRASH_BUF_SIZE >> 3];
 #endif
+#if defined(IMAGE_BL31) && CTX_EL2_LAZY_RESTORE
+	/* EL2 context last saved to the EL2 registers, see context_mgmt.c */
+	void *el2_sysregs_live;
+#endif
 #if ENABLE_RUNTIME_INSTRUMENTATION
 	uint64_t cpu_data_pmf_ts[CPU_DATA_PMF_TS_COUNT];
 #endif
@@ -159,6 +171,12 @@ CASSERT(CPU_DATA_CRASH_BUF_OFFSET == __builtin_offsetof
 	assert_cpu_data_crash_stack_offset_mismatch);
 #endif
 
+#if defined(IMAGE_BL31) && CTX_EL2_LAZY_RESTORE
+CASSERT(CPU_DATA_EL2_LIVE_OFFSET == __builtin_offsetof
+	(cpu_data_t, el2_sysregs_live),
+	assert_cpu_data_el2_live_offset_mismatch);
+#endif
+
 CASSERT(CPU_DATA_SIZE == sizeof(cpu_data_t),
 		assert_cpu_data_size_mismatch);
 
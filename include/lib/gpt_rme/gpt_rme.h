@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2022-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -263,7 +263,8 @@ void gpt_disable(void);
  * transition request occurs it is routed to this function where the request is
  * validated then fulfilled if possible.
  *
- * TODO: implement support for transitioning multiple granules at once.
+ * A range of granules is transitioned with a single lock acquisition, and
+ * either all the granules in the range are transitioned or none is.
  *
  * Parameters
  *   base: Base address of the region to transition, must be aligned to granule
@@ -277,4 +278,32 @@ void gpt_disable(void);
 int gpt_delegate_pas(uint64_t base, size_t size, unsigned int src_sec_state);
 int gpt_undelegate_pas(uint64_t base, size_t size, unsigned int src_sec_state);
 
+/*
+ * Function ID of the GPT statistics interface, in the Vendor-Specific EL3
+ * range.
+ *
+ * GPT_STATS_GET:
+ *	Returns SMC_OK in x0, then in x1 to x3 the number of Contiguous
+ *	descriptors shattered to Granules descriptors, and in x4 to x6 the
+ *	number fused back from them, for 2MB, 32MB and 512MB blocks. The
+ *	counters are summed over all CPUs.
+ */
+#define GPT_STATS_GET_64		U(0xC7000060)
+
+#define GPT_STATS_FID_MASK		U(0xfff0)
+#define GPT_STATS_FID_VALUE		U(0x60)
+#define is_gpt_stats_fid(_fid) \
+	(((_fid) & GPT_STATS_FID_MASK) == GPT_STATS_FID_VALUE)
+
+#if RME_GPT_STATS
+uintptr_t gpt_stats_smc_handler(unsigned int smc_fid,
+				u_register_t x1,
+				u_register_t x2,
+				u_register_t x3,
+				u_register_t x4,
+				void *cookie,
+				void *handle,
+				u_register_t flags);
+#endif
+
 #endif /* GPT_RME_H */
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef LOCK_STATS_H
+#define LOCK_STATS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <lib/psci/psci.h>
+#include <lib/spinlock.h>
+#include <lib/utils_def.h>
+
+/*
+ * Maximum number of locks with statistics: one per non-CPU power domain for
+ * PSCI, plus the locks of the other EL3 components.
+ */
+#define LOCK_STATS_MAX			(PSCI_NUM_NON_CPU_PWR_DOMAINS + U(8))
+
+/*
+ * Function IDs of the lock statistics interface, in the Vendor-Specific EL3
+ * range.
+ *
+ * LOCK_STATS_DUMP:
+ *	Prints the statistics of all locks on the console. Only available in
+ *	DEBUG builds.
+ *	Returns SMC_OK in x0 and the number of locks in x1.
+ * LOCK_STATS_GET:
+ *	x1: Index of the lock, from 0 to the number of locks - 1.
+ *	Returns SMC_OK in x0, then in x1 to x5 the number of acquisitions,
+ *	the number of contended acquisitions, the average and maximum wait
+ *	time and the maximum hold time, in system counter ticks. Returns
+ *	SMC_INVALID_PARAM in x0 if the index is out of range.
+ */
+#define LOCK_STATS_DUMP_32		U(0x87000050)
+#define LOCK_STATS_GET_64		U(0xC7000051)
+
+#define LOCK_STATS_FID_MASK		U(0xfff0)
+#define LOCK_STATS_FID_VALUE		U(0x50)
+#define is_lock_stats_fid(_fid) \
+	(((_fid) & LOCK_STATS_FID_MASK) == LOCK_STATS_FID_VALUE)
+
+/*
+ * Statistics of a lock. Wait and hold times are in system counter ticks.
+ * The statistics are updated by the CPU holding the lock, so they need no
+ * locking of their own.
+ */
+typedef struct lock_stats {
+	const char *name;
+	unsigned int id;
+	const void *lock;
+	uint64_t acquired;
+	uint64_t contended;
+	uint64_t wait_total;
+	uint64_t wait_max;
+	uint64_t hold_max;
+	uint64_t hold_start;
+} lock_stats_t;
+
+#if LOCK_STATS
+/*
+ * Locks are registered by address, so the same functions work for spinlocks
+ * and bakery locks. They must be registered by the primary CPU during cold
+ * boot, before other CPUs take them. 'id' tells apart the locks which share a
+ * name.
+ */
+int lock_stats_register(const void *lock, const char *name, unsigned int id);
+
+/* Hooks called by the lock implementations with the lock held */
+void lock_stats_acquired(const void *lock, uint64_t start, bool contended);
+void lock_stats_released(const void *lock);
+
+int lock_stats_get(unsigned int idx, lock_stats_t *stats);
+void lock_stats_dump(void);
+
+uintptr_t lock_stats_smc_handler(unsigned int smc_fid,
+				 u_register_t x1,
+				 u_register_t x2,
+				 u_register_t x3,
+				 u_register_t x4,
+				 void *cookie,
+				 void *handle,
+				 u_register_t flags);
+#else
+static inline int lock_stats_register(const void *lock, const char *name,
+				      unsigned int id)
+{
+	return 0;
+}
+#endif /* LOCK_STATS */
+
+#endif /* LOCK_STATS_H */
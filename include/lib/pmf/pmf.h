@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2016-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -57,6 +57,8 @@
 #define PMF_SMC_GET_VERSION_32		U(0x87000021)
 #define PMF_SMC_GET_VERSION_64		U(0xC7000021)
 
+#define PMF_SMC_GET_SMC_STATS_64	U(0xC7000022)
+
 #define PMF_SMC_VERSION			U(0x00000001)
 
 /*
@@ -71,6 +73,31 @@
 #define PMF_PSCI_STAT_SVC_ID	0
 #define PMF_RT_INSTR_SVC_ID	1
 
+/*
+ * Per-CPU statistics of the SMCs handled by BL31, collected when
+ * ENABLE_SMC_STATS is set. Latencies are measured in system counter ticks,
+ * from the exception entry into EL3 to the return of the SMC handler.
+ * Bucket N of the histogram counts the calls which took between 2^N and
+ * 2^(N + 1) - 1 ticks. The last bucket also counts all longer calls.
+ * Calls whose function ID does not fit in the table are accounted for in the
+ * last entry, which uses PMF_SMC_STATS_FID_OTHER as function ID.
+ */
+#define PMF_SMC_STATS_ENTRIES	32
+#define PMF_SMC_STATS_BUCKETS	24
+#define PMF_SMC_STATS_FID_OTHER	U(0xFFFFFFFF)
+
+struct pmf_smc_stats {
+	uint32_t fid;		/* Function ID */
+	uint32_t valid;		/* 1 if the entry is in use, 0 otherwise */
+	uint64_t count;		/* Number of calls */
+	uint64_t total_ticks;	/* Sum of the latencies */
+	uint64_t max_ticks;	/* Longest latency */
+	uint32_t buckets[PMF_SMC_STATS_BUCKETS];
+};
+
+/* Table of each CPU, indexed by core position */
+extern struct pmf_smc_stats pmf_smc_stats[][PMF_SMC_STATS_ENTRIES];
+
 /*******************************************************************************
  * Function & variable prototypes
  ******************************************************************************/
@@ -80,6 +107,11 @@ int pmf_get_timestamp_smc(unsigned int tid,
 		unsigned int flags,
 		unsigned long long *ts_value);
 int pmf_setup(void);
+void pmf_smc_stats_record(uint32_t smc_fid);
+int pmf_get_smc_stats_smc(unsigned int idx,
+		u_register_t mpidr,
+		unsigned int offset,
+		uint64_t words[6]);
 uintptr_t pmf_smc_handler(unsigned int smc_fid,
 		u_register_t x1,
 		u_register_t x2,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -22,6 +22,23 @@ typedef struct bitlock {
 void spin_lock(spinlock_t *lock);
 void spin_unlock(spinlock_t *lock);
 
+/*
+ * Locks are instrumented in BL31 when ENABLE_LOCK_STATS is set. C callers of
+ * spin_lock() and spin_unlock() then go through the lock statistics wrappers,
+ * while assembly callers keep using the plain functions.
+ */
+#if ENABLE_LOCK_STATS && defined(IMAGE_BL31)
+#define LOCK_STATS	1
+
+void lock_stats_spin_lock(spinlock_t *lock);
+void lock_stats_spin_unlock(spinlock_t *lock);
+
+#define spin_lock(_lock)	lock_stats_spin_lock(_lock)
+#define spin_unlock(_lock)	lock_stats_spin_unlock(_lock)
+#else
+#define LOCK_STATS	0
+#endif
+
 void bit_lock(bitlock_t *lock, uint8_t mask);
 void bit_unlock(bitlock_t *lock, uint8_t mask);
 
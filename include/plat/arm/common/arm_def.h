@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -437,8 +437,19 @@ MEASURED_BOOT
  */
 #define ARM_BL_REGIONS			7
 
+/*
+ * With the SMC batch interface, BL31 maps the buffer of each CPU in a dynamic
+ * region of its own.
+ */
+#if ENABLE_SMC_BATCH && defined(IMAGE_BL31)
+#define ARM_SMC_BATCH_REGIONS		PLATFORM_CORE_COUNT
+#else
+#define ARM_SMC_BATCH_REGIONS		0
+#endif
+
 #define MAX_MMAP_REGIONS		(PLAT_ARM_MMAP_ENTRIES +	\
-					 ARM_BL_REGIONS)
+					 ARM_BL_REGIONS +		\
+					 ARM_SMC_BATCH_REGIONS)
 
 /* Memory mapped Generic timer interfaces  */
 #ifdef PLAT_ARM_SYS_CNTCTL_BASE
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -319,6 +319,7 @@ void bl2_el3_plat_arch_setup(void);
  * Optional BL2 at EL3 functions (may be overridden)
  ******************************************************************************/
 void bl2_el3_plat_prepare_exit(void);
+int bl2_el3_plat_release_secondaries(uintptr_t entrypoint);
 
 /*******************************************************************************
  * Mandatory BL2U functions.
@@ -378,6 +379,13 @@ size_t plat_rmmd_get_el3_rmm_shared_mem(uintptr_t *shared);
 int plat_rmmd_load_manifest(struct rmm_manifest *manifest);
 #endif
 
+/*******************************************************************************
+ * Mandatory BL31 functions when ENABLE_SMC_BATCH=1
+ ******************************************************************************/
+#if ENABLE_SMC_BATCH
+int plat_smc_batch_validate_buf(unsigned long long pa, size_t size);
+#endif
+
 /*******************************************************************************
  * Optional BL31 functions (may be overridden)
  ******************************************************************************/
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2021-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -132,6 +132,24 @@
 					/* 0x1B3 */
 #define RMM_ATTEST_GET_PLAT_TOKEN	SMC64_RMMD_EL3_FID(U(3))
 
+/*
+ * Delegate/undelegate a range of granules. EL3 may only transition the start
+ * of the range, in which case the RMM issues another call for the rest. Either
+ * all the granules of the part of the range handled are transitioned or none
+ * is.
+ * The arguments to these SMCs are :
+ *    arg0 - Function ID.
+ *    arg1 - PA of the start of the range, aligned to 4KB.
+ *    arg2 - Size of the range (in bytes), a multiple of 4KB.
+ * The return arguments are :
+ *    ret0 - Status / error.
+ *    ret1 - Number of bytes transitioned from the start of the range if
+ *           successful.
+ */
+					/* 0x1B4 - 0x1B5 */
+#define RMM_GTSI_DELEGATE_RANGE		SMC64_RMMD_EL3_FID(U(4))
+#define RMM_GTSI_UNDELEGATE_RANGE	SMC64_RMMD_EL3_FID(U(5))
+
 /* ECC Curve types for attest key generation */
 #define ATTEST_KEY_CURVE_ECC_SECP384R1		0
 
@@ -156,7 +174,7 @@
  * Increase this when a bug is fixed, or a feature is added without
  * breaking compatibility.
  */
-#define RMM_EL3_IFC_VERSION_MINOR	(U(2))
+#define RMM_EL3_IFC_VERSION_MINOR	(U(3))
 
 #define RMM_EL3_INTERFACE_VERSION				\
 	(((RMM_EL3_IFC_VERSION_MAJOR << 16) & 0x7FFFF) |	\
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef SMC_BATCH_H
+#define SMC_BATCH_H
+
+#include <stdint.h>
+
+#include <lib/smccc.h>
+#include <lib/xlat_tables/xlat_tables_defs.h>
+
+/*
+ * Function IDs of the SMC batch interface, in the Vendor-Specific EL3 range.
+ *
+ * SMC_BATCH_VERSION:
+ *	Returns SMC_OK in x0 and the interface version in x1.
+ * SMC_BATCH_REGISTER:
+ *	x1: Physical address of a 4KB aligned page of Non-secure DRAM used as
+ *	    the batch buffer of the calling CPU. Any other address is rejected
+ *	    with SMC_INVALID_PARAM.
+ * SMC_BATCH_EXECUTE:
+ *	x1: Number of entries of the batch buffer of the calling CPU to run.
+ *	Returns SMC_OK in x0 and the number of entries run in x1. Returns
+ *	SMC_DENIED if the calling CPU has not registered a buffer, and
+ *	SMC_INVALID_PARAM if x1 exceeds SMC_BATCH_MAX_ENTRIES.
+ *
+ * All calls return SMC_DENIED when made from the secure world.
+ */
+#define SMC_BATCH_VERSION_32		U(0x87000040)
+#define SMC_BATCH_VERSION_64		U(0xC7000040)
+#define SMC_BATCH_REGISTER_64		U(0xC7000041)
+#define SMC_BATCH_EXECUTE_64		U(0xC7000042)
+
+#define SMC_BATCH_FID_MASK		U(0xfff0)
+#define SMC_BATCH_FID_VALUE		U(0x40)
+#define is_smc_batch_fid(_fid) \
+	(((_fid) & SMC_BATCH_FID_MASK) == SMC_BATCH_FID_VALUE)
+
+#define SMC_BATCH_VERSION		U(0x00000001)
+
+/*
+ * Entry of a batch buffer. On input, regs[0] holds the function ID of the
+ * call and regs[1] to regs[7] its arguments. On output, regs[0] to regs[7]
+ * hold the values returned by the call, or SMC_UNK in regs[0] if the call
+ * is not allowed in a batch.
+ */
+struct smc_batch_entry {
+	uint64_t regs[8];
+};
+
+/* Maximum number of entries in a batch buffer */
+#define SMC_BATCH_MAX_ENTRIES		\
+	(PAGE_SIZE_4KB / sizeof(struct smc_batch_entry))
+
+uintptr_t smc_batch_handler(unsigned int smc_fid,
+			    u_register_t x1,
+			    u_register_t x2,
+			    u_register_t x3,
+			    u_register_t x4,
+			    void *cookie,
+			    void *handle,
+			    u_register_t flags);
+
+#endif /* SMC_BATCH_H */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, Arm Limited. All rights reserved.
+ * Copyright (c) 2019-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -7,6 +7,9 @@
 #include <assert.h>
 #include <common/debug.h>
 #include <lib/debugfs.h>
+#include <lib/pmf/pmf.h>
+
+#include <platform_def.h>
 
 #include "blobs.h"
 #include "dev.h"
@@ -21,6 +24,11 @@ static const dirtab_t dirtab[] = {
 };
 
 static const dirtab_t devfstab[] = {
+#if ENABLE_SMC_STATS
+	{"smcstats", DEV_ROOT_QSMCSTATS,
+	 PLATFORM_CORE_COUNT * sizeof(pmf_smc_stats[0]), O_READ,
+	 (void *)pmf_smc_stats}
+#endif
 };
 
 /*******************************************************************************
@@ -72,6 +80,14 @@ static int rootread(chan_t *channel, void *buf, int size)
 		return dirread(channel, dir, NULL, 0, rootgen);
 	}
 
+#if ENABLE_SMC_STATS
+	if (channel->qid == DEV_ROOT_QSMCSTATS) {
+		dp = &devfstab[0];
+		return buf_to_channel(channel, buf, dp->data, size,
+				      dp->length);
+	}
+#endif
+
 	/* Only makes sense when using debug language */
 	assert(channel->qid != DEV_ROOT_QBLOBCTL);
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, Arm Limited and Contributors. All rights reserved.
  * Copyright (c) 2022, NVIDIA Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
@@ -36,7 +36,10 @@
 #include <lib/extensions/sys_reg_trace.h>
 #include <lib/extensions/trbe.h>
 #include <lib/extensions/trf.h>
+#include <lib/pmf/pmf.h>
+#include <lib/runtime_instr.h>
 #include <lib/utils.h>
+#include <plat/common/platform.h>
 
 #if ENABLE_FEAT_TWED
 /* Make sure delay value fits within the range(0-15) */
@@ -51,6 +54,24 @@ static void manage_extensions_nonsecure(cpu_context_t *ctx);
 static void manage_extensions_secure(cpu_context_t *ctx);
 static void manage_extensions_secure_per_world(void);
 
+#if (CTX_EL2_LAZY_RESTORE && IMAGE_BL31)
+/*
+ * The per-cpu el2_sysregs_live pointer holds the EL2 context that the EL2
+ * registers of this CPU were last saved to, or NULL if the registers may have
+ * been written since. Until the next restore, the EL2 registers hold the values
+ * of this context, so the restore only needs to write the groups of registers
+ * whose values differ from it.
+ *
+ * Any EL3 code that writes an EL2 register directly must call this function
+ * first, otherwise the next restore may skip the register and leave the value
+ * written by EL3 in place.
+ */
+void cm_el2_sysregs_live_invalidate(void)
+{
+	set_cpu_data(el2_sysregs_live, NULL);
+}
+#endif /* (CTX_EL2_LAZY_RESTORE && IMAGE_BL31) */
+
 #if ((IMAGE_BL1) || (IMAGE_BL31 && (!CTX_INCLUDE_EL2_REGS)))
 static void setup_el1_context(cpu_context_t *ctx, const struct entry_point_info *ep)
 {
@@ -609,6 +630,9 @@ void cm_manage_extensions_el3(void)
 	}
 
 	pmuv3_init_el3();
+
+	/* The EL2 registers hold their reset values after power on */
+	cm_el2_sysregs_live_invalidate();
 }
 #endif /* IMAGE_BL31 */
 
@@ -1031,6 +1055,9 @@ void cm_prepare_el3_exit(uint32_t security_state)
 
 	assert(ctx != NULL);
 
+	/* Some EL2 registers are written directly below */
+	cm_el2_sysregs_live_invalidate();
+
 	if (security_state == NON_SECURE) {
 		uint64_t el2_implemented = el_implemented(2);
 
@@ -1096,6 +1123,138 @@ void cm_prepare_el3_exit(uint32_t security_state)
 
 #if (CTX_INCLUDE_EL2_REGS && IMAGE_BL31)
 
+/*
+ * Check whether two EL2 contexts hold the same values for a group of
+ * registers. Used by the el2_ctx_<feature>_equal() macros.
+ */
+static bool el2_ctx_regs_equal(const void *regs, const void *live_regs,
+			       size_t size)
+{
+	const uint64_t *a = regs;
+	const uint64_t *b = live_regs;
+
+	for (size_t i = 0U; i < (size / sizeof(uint64_t)); i++) {
+		if (a[i] != b[i]) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/*
+ * The el2_ctx_<feature>_equal() macros check whether two contexts hold the
+ * same values for the registers of a feature. They are always false for
+ * features whose registers are not part of the context.
+ */
+#define el2_ctx_group_equal(ctx, live, grp)				\
+	el2_ctx_regs_equal(&((ctx)->grp), &((live)->grp), sizeof((ctx)->grp))
+
+#define el2_ctx_common_equal(ctx, live)	el2_ctx_group_equal(ctx, live, common)
+
+#if ENABLE_FEAT_MTE2
+#define el2_ctx_mte2_equal(ctx, live)	el2_ctx_group_equal(ctx, live, mte2)
+#else
+#define el2_ctx_mte2_equal(ctx, live)	false
+#endif /* ENABLE_FEAT_MTE2 */
+
+#if ENABLE_FEAT_FGT
+#define el2_ctx_fgt_equal(ctx, live)	el2_ctx_group_equal(ctx, live, fgt)
+#else
+#define el2_ctx_fgt_equal(ctx, live)	false
+#endif /* ENABLE_FEAT_FGT */
+
+#if ENABLE_FEAT_FGT2
+#define el2_ctx_fgt2_equal(ctx, live)	el2_ctx_group_equal(ctx, live, fgt2)
+#else
+#define el2_ctx_fgt2_equal(ctx, live)	false
+#endif /* ENABLE_FEAT_FGT2 */
+
+#if ENABLE_FEAT_ECV
+#define el2_ctx_ecv_equal(ctx, live)	el2_ctx_group_equal(ctx, live, ecv)
+#else
+#define el2_ctx_ecv_equal(ctx, live)	false
+#endif /* ENABLE_FEAT_ECV */
+
+#if ENABLE_FEAT_VHE
+#define el2_ctx_vhe_equal(ctx, live)	el2_ctx_group_equal(ctx, live, vhe)
+#else
+#define el2_ctx_vhe_equal(ctx, live)	false
+#endif /* ENABLE_FEAT_VHE */
+
+#if ENABLE_FEAT_RAS
+#define el2_ctx_ras_equal(ctx, live)	el2_ctx_group_equal(ctx, live, ras)
+#else
+#define el2_ctx_ras_equal(ctx, live)	false
+#endif /* ENABLE_FEAT_RAS */
+
+#if CTX_INCLUDE_NEVE_REGS
+#define el2_ctx_neve_equal(ctx, live)	el2_ctx_group_equal(ctx, live, neve)
+#else
+#define el2_ctx_neve_equal(ctx, live)	false
+#endif /* CTX_INCLUDE_NEVE_REGS */
+
+#if ENABLE_TRF_FOR_NS
+#define el2_ctx_trf_equal(ctx, live)	el2_ctx_group_equal(ctx, live, trf)
+#else
+#define el2_ctx_trf_equal(ctx, live)	false
+#endif /* ENABLE_TRF_FOR_NS */
+
+#if ENABLE_FEAT_CSV2_2
+#define el2_ctx_csv2_2_equal(ctx, live)	el2_ctx_group_equal(ctx, live, csv2)
+#else
+#define el2_ctx_csv2_2_equal(ctx, live)	false
+#endif /* ENABLE_FEAT_CSV2_2 */
+
+#if ENABLE_FEAT_HCX
+#define el2_ctx_hcx_equal(ctx, live)	el2_ctx_group_equal(ctx, live, hcx)
+#else
+#define el2_ctx_hcx_equal(ctx, live)	false
+#endif /* ENABLE_FEAT_HCX */
+
+#if ENABLE_FEAT_TCR2
+#define el2_ctx_tcr2_equal(ctx, live)	el2_ctx_group_equal(ctx, live, tcr2)
+#else
+#define el2_ctx_tcr2_equal(ctx, live)	false
+#endif /* ENABLE_FEAT_TCR2 */
+
+#if (ENABLE_FEAT_S1POE || ENABLE_FEAT_S2POE)
+#define el2_ctx_sxpoe_equal(ctx, live)	el2_ctx_group_equal(ctx, live, sxpoe)
+#else
+#define el2_ctx_sxpoe_equal(ctx, live)	false
+#endif /* (ENABLE_FEAT_S1POE || ENABLE_FEAT_S2POE) */
+
+#if (ENABLE_FEAT_S1PIE || ENABLE_FEAT_S2PIE)
+#define el2_ctx_sxpie_equal(ctx, live)	el2_ctx_group_equal(ctx, live, sxpie)
+#else
+#define el2_ctx_sxpie_equal(ctx, live)	false
+#endif /* (ENABLE_FEAT_S1PIE || ENABLE_FEAT_S2PIE) */
+
+#if ENABLE_FEAT_S2PIE
+#define el2_ctx_s2pie_equal(ctx, live)	el2_ctx_group_equal(ctx, live, s2pie)
+#else
+#define el2_ctx_s2pie_equal(ctx, live)	false
+#endif /* ENABLE_FEAT_S2PIE */
+
+#if ENABLE_FEAT_GCS
+#define el2_ctx_gcs_equal(ctx, live)	el2_ctx_group_equal(ctx, live, gcs)
+#else
+#define el2_ctx_gcs_equal(ctx, live)	false
+#endif /* ENABLE_FEAT_GCS */
+
+#if CTX_INCLUDE_MPAM_REGS
+#define el2_ctx_mpam_equal(ctx, live)	el2_ctx_group_equal(ctx, live, mpam)
+#else
+#define el2_ctx_mpam_equal(ctx, live)	false
+#endif /* CTX_INCLUDE_MPAM_REGS */
+
+/*
+ * A group of EL2 registers needs to be restored unless the registers are known
+ * to already hold the values of the context.
+ */
+#define el2_ctx_restore_needed(feat, ctx, live)				\
+	(((live) == NULL) || !el2_ctx_##feat##_equal(ctx, live))
+
 static void el2_sysregs_context_save_fgt(el2_sysregs_t *ctx)
 {
 	write_el2_ctx_fgt(ctx, hdfgrtr_el2, read_hdfgrtr_el2());
@@ -1257,6 +1416,16 @@ static void el2_sysregs_context_save_gic(el2_sysregs_t *ctx)
 	write_el2_ctx_common(ctx, ich_vmcr_el2, read_ich_vmcr_el2());
 }
 
+static bool el2_ctx_gic_equal(el2_sysregs_t *ctx, el2_sysregs_t *live)
+{
+	return (read_el2_ctx_common(ctx, icc_sre_el2) ==
+		read_el2_ctx_common(live, icc_sre_el2)) &&
+	       (read_el2_ctx_common(ctx, ich_hcr_el2) ==
+		read_el2_ctx_common(live, ich_hcr_el2)) &&
+	       (read_el2_ctx_common(ctx, ich_vmcr_el2) ==
+		read_el2_ctx_common(live, ich_vmcr_el2));
+}
+
 static void el2_sysregs_context_restore_gic(el2_sysregs_t *ctx)
 {
 #if defined(SPD_spmd) && SPMD_SPM_AT_SEL2
@@ -1362,6 +1531,12 @@ void cm_el2_sysregs_context_save(uint32_t security_state)
 
 	el2_sysregs_ctx = get_el2_sysregs_ctx(ctx);
 
+#if ENABLE_RUNTIME_INSTRUMENTATION
+	PMF_CAPTURE_TIMESTAMP(rt_instr_svc,
+		RT_INSTR_ENTER_EL2_CTX_SAVE,
+		PMF_NO_CACHE_MAINT);
+#endif
+
 	el2_sysregs_context_save_common(el2_sysregs_ctx);
 	el2_sysregs_context_save_gic(el2_sysregs_ctx);
 
@@ -1434,6 +1609,17 @@ void cm_el2_sysregs_context_save(uint32_t security_state)
 		write_el2_ctx_gcs(el2_sysregs_ctx, gcscr_el2, read_gcscr_el2());
 		write_el2_ctx_gcs(el2_sysregs_ctx, gcspr_el2, read_gcspr_el2());
 	}
+
+#if CTX_EL2_LAZY_RESTORE
+	/* The EL2 registers now hold the values of this context */
+	set_cpu_data(el2_sysregs_live, el2_sysregs_ctx);
+#endif
+
+#if ENABLE_RUNTIME_INSTRUMENTATION
+	PMF_CAPTURE_TIMESTAMP(rt_instr_svc,
+		RT_INSTR_EXIT_EL2_CTX_SAVE,
+		PMF_NO_CACHE_MAINT);
+#endif
 }
 
 /*******************************************************************************
@@ -1443,84 +1629,128 @@ void cm_el2_sysregs_context_restore(uint32_t security_state)
 {
 	cpu_context_t *ctx;
 	el2_sysregs_t *el2_sysregs_ctx;
+	el2_sysregs_t *live = NULL;
 
 	ctx = cm_get_context(security_state);
 	assert(ctx != NULL);
 
 	el2_sysregs_ctx = get_el2_sysregs_ctx(ctx);
 
-	el2_sysregs_context_restore_common(el2_sysregs_ctx);
-	el2_sysregs_context_restore_gic(el2_sysregs_ctx);
+#if ENABLE_RUNTIME_INSTRUMENTATION
+	PMF_CAPTURE_TIMESTAMP(rt_instr_svc,
+		RT_INSTR_ENTER_EL2_CTX_RESTORE,
+		PMF_NO_CACHE_MAINT);
+#endif
 
-	if (is_feat_mte2_supported()) {
+#if CTX_EL2_LAZY_RESTORE
+	/*
+	 * Skip the groups of registers that already hold the values of this
+	 * context. Once restored, the registers are owned by the world that
+	 * runs next, so they are no longer known to match any context.
+	 */
+	live = get_cpu_data(el2_sysregs_live);
+	cm_el2_sysregs_live_invalidate();
+#endif
+
+	if (el2_ctx_restore_needed(common, el2_sysregs_ctx, live)) {
+		el2_sysregs_context_restore_common(el2_sysregs_ctx);
+	}
+
+	if (el2_ctx_restore_needed(gic, el2_sysregs_ctx, live)) {
+		el2_sysregs_context_restore_gic(el2_sysregs_ctx);
+	}
+
+	if (is_feat_mte2_supported() &&
+	    el2_ctx_restore_needed(mte2, el2_sysregs_ctx, live)) {
 		write_tfsr_el2(read_el2_ctx_mte2(el2_sysregs_ctx, tfsr_el2));
 	}
 
-	if (is_feat_mpam_supported()) {
+	if (is_feat_mpam_supported() &&
+	    el2_ctx_restore_needed(mpam, el2_sysregs_ctx, live)) {
 		el2_sysregs_context_restore_mpam(el2_sysregs_ctx);
 	}
 
-	if (is_feat_fgt_supported()) {
+	if (is_feat_fgt_supported() &&
+	    el2_ctx_restore_needed(fgt, el2_sysregs_ctx, live)) {
 		el2_sysregs_context_restore_fgt(el2_sysregs_ctx);
 	}
 
-	if (is_feat_fgt2_supported()) {
+	if (is_feat_fgt2_supported() &&
+	    el2_ctx_restore_needed(fgt2, el2_sysregs_ctx, live)) {
 		el2_sysregs_context_restore_fgt2(el2_sysregs_ctx);
 	}
 
-	if (is_feat_ecv_v2_supported()) {
+	if (is_feat_ecv_v2_supported() &&
+	    el2_ctx_restore_needed(ecv, el2_sysregs_ctx, live)) {
 		write_cntpoff_el2(read_el2_ctx_ecv(el2_sysregs_ctx, cntpoff_el2));
 	}
 
-	if (is_feat_vhe_supported()) {
+	if (is_feat_vhe_supported() &&
+	    el2_ctx_restore_needed(vhe, el2_sysregs_ctx, live)) {
 		write_contextidr_el2(read_el2_ctx_vhe(el2_sysregs_ctx,
 					contextidr_el2));
 		write_ttbr1_el2(read_el2_ctx_vhe(el2_sysregs_ctx, ttbr1_el2));
 	}
 
-	if (is_feat_ras_supported()) {
+	if (is_feat_ras_supported() &&
+	    el2_ctx_restore_needed(ras, el2_sysregs_ctx, live)) {
 		write_vdisr_el2(read_el2_ctx_ras(el2_sysregs_ctx, vdisr_el2));
 		write_vsesr_el2(read_el2_ctx_ras(el2_sysregs_ctx, vsesr_el2));
 	}
 
-	if (is_feat_nv2_supported()) {
+	if (is_feat_nv2_supported() &&
+	    el2_ctx_restore_needed(neve, el2_sysregs_ctx, live)) {
 		write_vncr_el2(read_el2_ctx_neve(el2_sysregs_ctx, vncr_el2));
 	}
 
-	if (is_feat_trf_supported()) {
+	if (is_feat_trf_supported() &&
+	    el2_ctx_restore_needed(trf, el2_sysregs_ctx, live)) {
 		write_trfcr_el2(read_el2_ctx_trf(el2_sysregs_ctx, trfcr_el2));
 	}
 
-	if (is_feat_csv2_2_supported()) {
+	if (is_feat_csv2_2_supported() &&
+	    el2_ctx_restore_needed(csv2_2, el2_sysregs_ctx, live)) {
 		write_scxtnum_el2(read_el2_ctx_csv2_2(el2_sysregs_ctx,
 					scxtnum_el2));
 	}
 
-	if (is_feat_hcx_supported()) {
+	if (is_feat_hcx_supported() &&
+	    el2_ctx_restore_needed(hcx, el2_sysregs_ctx, live)) {
 		write_hcrx_el2(read_el2_ctx_hcx(el2_sysregs_ctx, hcrx_el2));
 	}
 
-	if (is_feat_tcr2_supported()) {
+	if (is_feat_tcr2_supported() &&
+	    el2_ctx_restore_needed(tcr2, el2_sysregs_ctx, live)) {
 		write_tcr2_el2(read_el2_ctx_tcr2(el2_sysregs_ctx, tcr2_el2));
 	}
 
-	if (is_feat_sxpie_supported()) {
+	if (is_feat_sxpie_supported() &&
+	    el2_ctx_restore_needed(sxpie, el2_sysregs_ctx, live)) {
 		write_pire0_el2(read_el2_ctx_sxpie(el2_sysregs_ctx, pire0_el2));
 		write_pir_el2(read_el2_ctx_sxpie(el2_sysregs_ctx, pir_el2));
 	}
 
-	if (is_feat_sxpoe_supported()) {
+	if (is_feat_sxpoe_supported() &&
+	    el2_ctx_restore_needed(sxpoe, el2_sysregs_ctx, live)) {
 		write_por_el2(read_el2_ctx_sxpoe(el2_sysregs_ctx, por_el2));
 	}
 
-	if (is_feat_s2pie_supported()) {
+	if (is_feat_s2pie_supported() &&
+	    el2_ctx_restore_needed(s2pie, el2_sysregs_ctx, live)) {
 		write_s2pir_el2(read_el2_ctx_s2pie(el2_sysregs_ctx, s2pir_el2));
 	}
 
-	if (is_feat_gcs_supported()) {
+	if (is_feat_gcs_supported() &&
+	    el2_ctx_restore_needed(gcs, el2_sysregs_ctx, live)) {
 		write_gcscr_el2(read_el2_ctx_gcs(el2_sysregs_ctx, gcscr_el2));
 		write_gcspr_el2(read_el2_ctx_gcs(el2_sysregs_ctx, gcspr_el2));
 	}
+
+#if ENABLE_RUNTIME_INSTRUMENTATION
+	PMF_CAPTURE_TIMESTAMP(rt_instr_svc,
+		RT_INSTR_EXIT_EL2_CTX_RESTORE,
+		PMF_NO_CACHE_MAINT);
+#endif
 }
 #endif /* (CTX_INCLUDE_EL2_REGS && IMAGE_BL31) */
 
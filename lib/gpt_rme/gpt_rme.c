@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, Arm Limited. All rights reserved.
+ * Copyright (c) 2022-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -16,9 +16,13 @@
 #include <common/debug.h>
 #include "gpt_rme_private.h"
 #include <lib/gpt_rme/gpt_rme.h>
+#include <lib/lock_stats.h>
 #include <lib/smccc.h>
 #include <lib/spinlock.h>
+#include <lib/utils.h>
 #include <lib/xlat_tables/xlat_tables_v2.h>
+#include <plat/common/platform.h>
+#include <smccc_helpers.h>
 
 #if !ENABLE_RME
 #error "ENABLE_RME must be enabled to use the GPT library"
@@ -139,6 +143,20 @@ static spinlock_t gpt_lock;
 static bitlock_t *gpt_bitlock_base;
 #endif
 
+#if RME_GPT_STATS
+/*
+ * Per-CPU counters of shattered and fused Contiguous descriptors. GPT entries
+ * in different bitlock blocks can be changed concurrently, so each CPU updates
+ * its own counters.
+ */
+static gpt_stats_t gpt_stats[PLATFORM_CORE_COUNT];
+
+#define GPT_STATS_INC(_type, _level)	\
+	gpt_stats[plat_my_core_pos()]._type[(_level)]++
+#else
+#define GPT_STATS_INC(_type, _level)
+#endif
+
 /* Lock/unlock macros for GPT entries */
 #if (RME_GPT_BITLOCK_BLOCK == 0)
 /*
@@ -157,20 +175,62 @@ static bitlock_t *gpt_bitlock_base;
 #define GPT_UNLOCK	bit_unlock(gpi_info.lock, gpi_info.mask)
 #endif
 
+/* Look-up table for invalidation TLBs for 4KB, 16KB and 64KB pages */
+static const gpt_tlbi_lookup_t tlbi_page_lookup[] = {
+	{ tlbirpalos_4k, ~(SZ_4K - 1UL) },
+	{ tlbirpalos_64k, ~(SZ_64K - 1UL) },
+	{ tlbirpalos_16k, ~(SZ_16K - 1UL) }
+};
+
 static void tlbi_page_dsbosh(uintptr_t base)
 {
-	/* Look-up table for invalidation TLBs for 4KB, 16KB and 64KB pages */
-	static const gpt_tlbi_lookup_t tlbi_page_lookup[] = {
-		{ tlbirpalos_4k, ~(SZ_4K - 1UL) },
-		{ tlbirpalos_64k, ~(SZ_64K - 1UL) },
-		{ tlbirpalos_16k, ~(SZ_16K - 1UL) }
-	};
-
 	tlbi_page_lookup[gpt_config.pgs].function(
 			base & tlbi_page_lookup[gpt_config.pgs].mask);
 	dsbosh();
 }
 
+/*
+ * Invalidate cached GPT information for all granules in the range
+ * [base, base + size) and wait for the invalidation to complete.
+ * Naturally aligned 512MB, 32MB and 2MB blocks are invalidated with a
+ * single TLBI RPALOS each. The unaligned head and tail of the range are
+ * invalidated per 2MB block when more than one granule of the block is
+ * in range, which only over-invalidates granules that did not change.
+ */
+static void tlbi_range_dsbosh(uintptr_t base, size_t size)
+{
+	size_t gran_size = GPT_PGS_ACTUAL_SIZE(gpt_config.p);
+	uintptr_t end = base + size;
+	uintptr_t next;
+
+	while (base < end) {
+		if (((base & (SZ_512M - 1UL)) == 0UL) &&
+		    ((end - base) >= SZ_512M)) {
+			tlbirpalos_512m(base);
+			base += SZ_512M;
+		} else if (((base & (SZ_32M - 1UL)) == 0UL) &&
+			   ((end - base) >= SZ_32M)) {
+			tlbirpalos_32m(base);
+			base += SZ_32M;
+		} else {
+			next = ALIGN_2MB(base) + SZ_2M;
+			if (next > end) {
+				next = end;
+			}
+
+			if ((next - base) > gran_size) {
+				tlbirpalos_2m(ALIGN_2MB(base));
+			} else {
+				tlbi_page_lookup[gpt_config.pgs].function(
+					base & tlbi_page_lookup[gpt_config.pgs].mask);
+			}
+			base = next;
+		}
+	}
+
+	dsbosh();
+}
+
 /*
  * Helper function to fill out GPI entries in a single L1 table
  * with Granules or Contiguous descriptor.
@@ -1337,6 +1397,8 @@ int gpt_runtime_init(void)
 	/* Bitlocks at the end of L0 table */
 	gpt_bitlock_base = (bitlock_t *)(gpt_config.plat_gpt_l0_base +
 					GPT_L0_TABLE_SIZE(gpt_config.t));
+#else
+	(void)lock_stats_register(&gpt_lock, "gpt", 0U);
 #endif
 	VERBOSE("GPT: Runtime Configuration\n");
 	VERBOSE("  PPS/T:     0x%x/%u\n", gpt_config.pps, gpt_config.t);
@@ -1416,10 +1478,8 @@ static void read_gpi(gpi_info_t *gpi_info)
 	}
 }
 
-static void flush_page_to_popa(uintptr_t addr)
+static void flush_range_to_popa(uintptr_t addr, size_t size)
 {
-	size_t size = GPT_PGS_ACTUAL_SIZE(gpt_config.p);
-
 	if (is_feat_mte2_supported()) {
 		flush_dcache_to_popa_range_mte2(addr, size);
 	} else {
@@ -1427,6 +1487,11 @@ static void flush_page_to_popa(uintptr_t addr)
 	}
 }
 
+static void flush_page_to_popa(uintptr_t addr)
+{
+	flush_range_to_popa(addr, GPT_PGS_ACTUAL_SIZE(gpt_config.p));
+}
+
 /*
  * Helper function to check if all L1 entries in 2MB block have
  * the same Granules descriptor value.
@@ -1476,6 +1541,8 @@ __unused static void fuse_2mb(uint64_t base, const gpi_info_t *gpi_info,
 	VERBOSE("GPT: %s(0x%"PRIxPTR" 0x%"PRIx64")\n", __func__, base, l1_desc);
 
 	fill_desc(&gpi_info->gpt_l1_addr[idx_2], l1_cont_desc, L1_QWORDS_2MB);
+
+	GPT_STATS_INC(fuse, GPT_STATS_2MB);
 }
 
 /*
@@ -1513,8 +1580,20 @@ __unused static bool check_fuse_32mb(uint64_t base, const gpi_info_t *gpi_info,
 	 */
 	while (cnt-- != 0U) {
 		if (gpi_info->gpt_l1_addr[idx] != l1_cont_desc) {
-			/* Non-matching L1 entry found */
-			return false;
+			/*
+			 * A 2MB block with all Granules descriptors set to
+			 * 'l1_desc' which was not fused yet, e.g. because it was
+			 * generated at initialisation time, is fused now.
+			 */
+			if ((gpi_info->gpt_l1_addr[idx] != l1_desc) ||
+			    !check_fuse_2mb(ALIGN_32MB(base) + (cnt * SZ_2M),
+					    gpi_info, l1_desc)) {
+				/* Non-matching L1 entry found */
+				return false;
+			}
+
+			fuse_2mb(ALIGN_32MB(base) + (cnt * SZ_2M), gpi_info,
+				 l1_desc);
 		}
 		idx -= gpt_l1_cnt_2mb;
 	}
@@ -1534,6 +1613,8 @@ __unused static void fuse_32mb(uint64_t base, const gpi_info_t *gpi_info,
 	VERBOSE("GPT: %s(0x%"PRIxPTR" 0x%"PRIx64")\n", __func__, base, l1_desc);
 
 	fill_desc(&gpi_info->gpt_l1_addr[idx_32], l1_cont_desc, L1_QWORDS_32MB);
+
+	GPT_STATS_INC(fuse, GPT_STATS_32MB);
 }
 
 /*
@@ -1592,6 +1673,8 @@ __unused static void fuse_512mb(uint64_t base, const gpi_info_t *gpi_info,
 	VERBOSE("GPT: %s(0x%"PRIxPTR" 0x%"PRIx64")\n", __func__, base, l1_desc);
 
 	fill_desc(&gpi_info->gpt_l1_addr[idx_512], l1_cont_desc, L1_QWORDS_512MB);
+
+	GPT_STATS_INC(fuse, GPT_STATS_512MB);
 }
 
 /*
@@ -1673,6 +1756,7 @@ __unused static void shatter_block(uint64_t base, gpi_info_t *gpi_info,
 
 	/* Shatter contiguous block */
 	gpt_shatter_lookup[level](base, gpi_info, l1_desc);
+	GPT_STATS_INC(shatter, level);
 
 	tlbi_lookup[level].function(base & tlbi_lookup[level].mask);
 	dsbosh();
@@ -1684,12 +1768,435 @@ __unused static void shatter_block(uint64_t base, gpi_info_t *gpi_info,
 	gpi_info->gpt_l1_desc = l1_desc;
 }
 
+/*
+ * Helper to check that the base and size of a granule transition request
+ * are valid.
+ *
+ * Parameters
+ *   base		Base address of the region to transition.
+ *   size		Size of region to transition.
+ *
+ * Return
+ *   -EINVAL if the region is invalid, 0 otherwise.
+ */
+static int validate_transition_range(uint64_t base, size_t size)
+{
+	/* Check that base and size are valid */
+	if ((ULONG_MAX - base) < size) {
+		VERBOSE("GPT: Transition request address overflow!\n");
+		VERBOSE("      Base=0x%"PRIx64"\n", base);
+		VERBOSE("      Size=0x%lx\n", size);
+		return -EINVAL;
+	}
+
+	/* Make sure base and size are valid */
+	if (((base & (GPT_PGS_ACTUAL_SIZE(gpt_config.p) - 1UL)) != 0UL) ||
+	    ((size & (GPT_PGS_ACTUAL_SIZE(gpt_config.p) - 1UL)) != 0UL) ||
+	    (size == 0UL) ||
+	    ((base + size) >= GPT_PPS_ACTUAL_SIZE(gpt_config.t))) {
+		VERBOSE("GPT: Invalid granule transition address range!\n");
+		VERBOSE("      Base=0x%"PRIx64"\n", base);
+		VERBOSE("      Size=0x%lx\n", size);
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+/*
+ * Helpers to acquire and release the lock(s) protecting the GPT entries of
+ * all granules in the range [base, base + size). Bitlocks are acquired in
+ * ascending block order, so that concurrent range transitions cannot
+ * deadlock.
+ */
+static void lock_range(__unused uint64_t base, __unused size_t size)
+{
+#if (RME_GPT_BITLOCK_BLOCK == 0)
+	spin_lock(&gpt_lock);
+#else
+	unsigned int first = (unsigned int)(base /
+					(RME_GPT_BITLOCK_BLOCK * SZ_512M));
+	unsigned int last = (unsigned int)((base + size - 1UL) /
+					(RME_GPT_BITLOCK_BLOCK * SZ_512M));
+
+	for (unsigned int i = first; i <= last; i++) {
+		bit_lock(&gpt_bitlock_base[i / LOCK_BITS],
+			 (LOCK_TYPE)(1U << (i & (LOCK_BITS - 1U))));
+	}
+#endif
+}
+
+static void unlock_range(__unused uint64_t base, __unused size_t size)
+{
+#if (RME_GPT_BITLOCK_BLOCK == 0)
+	spin_unlock(&gpt_lock);
+#else
+	unsigned int first = (unsigned int)(base /
+					(RME_GPT_BITLOCK_BLOCK * SZ_512M));
+	unsigned int last = (unsigned int)((base + size - 1UL) /
+					(RME_GPT_BITLOCK_BLOCK * SZ_512M));
+
+	for (unsigned int i = last + 1U; i-- > first; ) {
+		bit_unlock(&gpt_bitlock_base[i / LOCK_BITS],
+			   (LOCK_TYPE)(1U << (i & (LOCK_BITS - 1U))));
+	}
+#endif
+}
+
+/*
+ * Helper to get the mask of the GPI fields of the granules from 'base' up
+ * to 'end' that are described by the L1 entry in 'gpi_info'.
+ *
+ * Parameters
+ *   base		Address of the first granule
+ *   end		End address of the range (exclusive)
+ *   gpi_info		Pointer to 'gpi_info_t' structure for 'base'
+ *   cnt		Returns the number of granules in the mask
+ *
+ * Return
+ *   Mask of the GPI fields.
+ */
+static uint64_t get_l1_gpi_mask(uint64_t base, uint64_t end,
+				const gpi_info_t *gpi_info, unsigned int *cnt)
+{
+	/* Number of granules left in the range */
+	uint64_t left = (end - base) >> GPT_L1_GPI_IDX_SHIFT(gpt_config.p);
+
+	/* 16 GPI fields in L1 entry */
+	*cnt = 16U - (gpi_info->gpi_shift >> 2);
+	if (left < *cnt) {
+		*cnt = (unsigned int)left;
+	}
+
+	if (*cnt == 16U) {
+		return ~0UL;
+	}
+
+	return ((1UL << (*cnt << 2)) - 1UL) << gpi_info->gpi_shift;
+}
+
+/*
+ * Helper to check that all granules in the range [base, base + size) have
+ * the same GPI. This function is called with the lock(s) for the range
+ * acquired.
+ *
+ * Parameters
+ *   base		Base address of the range
+ *   size		Size of the range
+ *   gpi		Expected GPI
+ *
+ * Return
+ *   -EINVAL if the range is not covered by L1 tables, -EPERM if any
+ *   granule has a different GPI, 0 otherwise.
+ */
+static int check_range_gpi(uint64_t base, size_t size, unsigned int gpi)
+{
+	uint64_t gpi_desc = build_l1_desc(gpi);
+	uint64_t end = base + size;
+	gpi_info_t gpi_info;
+	unsigned int cnt;
+	uint64_t mask;
+	int res;
+
+	while (base < end) {
+		res = get_gpi_params(base, &gpi_info);
+		if (res != 0) {
+			return res;
+		}
+
+		mask = get_l1_gpi_mask(base, end, &gpi_info, &cnt);
+		read_gpi(&gpi_info);
+
+		if ((gpi_info.gpt_l1_desc & GPT_L1_TYPE_CONT_DESC_MASK) ==
+						GPT_L1_TYPE_CONT_DESC) {
+			/* All granules share the GPI of Contiguous descriptor */
+			if (gpi_info.gpi != gpi) {
+				mask = ~0UL;
+			} else {
+				mask = 0UL;
+			}
+		} else {
+			mask &= gpi_info.gpt_l1_desc ^ gpi_desc;
+		}
+
+		if (mask != 0UL) {
+			VERBOSE("GPT: Granule 0x%"PRIx64" GPI is not 0x%x\n",
+				base, gpi);
+			VERBOSE("      L1 descriptor: 0x%"PRIx64"\n",
+				gpi_info.gpt_l1_desc);
+			return -EPERM;
+		}
+
+		base += (uint64_t)cnt << GPT_L1_GPI_IDX_SHIFT(gpt_config.p);
+	}
+
+	return 0;
+}
+
+/*
+ * Helper to set GPI of all granules in the range [base, base + size) to
+ * 'target_pas', writing every L1 entry once. Contiguous descriptors which
+ * are only partially covered by the range are shattered first; those fully
+ * covered are directly replaced with Granules descriptors. This function is
+ * called with the lock(s) for the range acquired.
+ *
+ * Parameters
+ *   base		Base address of the range
+ *   size		Size of the range
+ *   l1_desc		GPT Granules descriptor of the current GPI
+ *   target_pas		GPI to set
+ */
+static void write_gpt_range(uint64_t base, size_t size,
+			    __unused uint64_t l1_desc, unsigned int target_pas)
+{
+	uint64_t target_desc = build_l1_desc(target_pas);
+	uint64_t end = base + size;
+	__unused unsigned long level;
+	gpi_info_t gpi_info;
+	unsigned int cnt;
+	uint64_t mask;
+
+	while (base < end) {
+		(void)get_gpi_params(base, &gpi_info);
+		mask = get_l1_gpi_mask(base, end, &gpi_info, &cnt);
+		gpi_info.gpt_l1_desc = gpi_info.gpt_l1_addr[gpi_info.idx];
+
+#if (RME_GPT_MAX_BLOCK != 0)
+		/* Check for Contiguous descriptor */
+		if ((gpi_info.gpt_l1_desc & GPT_L1_TYPE_CONT_DESC_MASK) ==
+						GPT_L1_TYPE_CONT_DESC) {
+			/* 2MB, 32MB or 512MB block */
+			level = (GPT_L1_CONT_CONTIG(gpi_info.gpt_l1_desc) - 1UL)
+									<< 2;
+			if (((base & ((SZ_2M << level) - 1UL)) == 0UL) &&
+			    ((end - base) >= (SZ_2M << level))) {
+				fill_desc(&gpi_info.gpt_l1_addr[gpi_info.idx],
+					  target_desc, L1_QWORDS_2MB << level);
+				base += SZ_2M << level;
+				continue;
+			}
+
+			shatter_block(base, &gpi_info, l1_desc);
+		}
+#endif
+		gpi_info.gpt_l1_addr[gpi_info.idx] =
+				(gpi_info.gpt_l1_desc & ~mask) | (target_desc & mask);
+
+		base += (uint64_t)cnt << GPT_L1_GPI_IDX_SHIFT(gpt_config.p);
+	}
+
+	dsboshst();
+}
+
+#if (RME_GPT_MAX_BLOCK != 0)
+/*
+ * Helper to try to fuse all 2MB blocks touched by the range
+ * [base, base + size) to Contiguous descriptors. This function is called
+ * with the lock(s) for the range acquired.
+ *
+ * Parameters
+ *   base		Base address of the range
+ *   size		Size of the range
+ *   l1_desc		GPT Granules descriptor of the new GPI
+ */
+static void fuse_range(uint64_t base, size_t size, uint64_t l1_desc)
+{
+	uint64_t end = base + size;
+	gpi_info_t gpi_info;
+
+	while (base < end) {
+		(void)get_gpi_params(base, &gpi_info);
+		if (gpi_info.gpt_l1_addr[gpi_info.idx] == l1_desc) {
+			/* Try to fuse */
+			fuse_block(base, &gpi_info, l1_desc);
+		}
+
+		base = ALIGN_2MB(base) + SZ_2M;
+	}
+}
+#endif
+
+/*
+ * Helper to delegate all granules in the range [base, base + size) from NS
+ * to 'target_pas' with a single lock acquisition. The steps are the ones
+ * of gpt_delegate_pas(), with the cache maintenance and TLB invalidation
+ * done once for the whole range. No granule is transitioned if any of them
+ * is not in NS state.
+ */
+static int delegate_range(uint64_t base, size_t size, unsigned int target_pas,
+			  uint64_t nse, __unused uint64_t l1_desc)
+{
+	int res;
+
+	lock_range(base, size);
+
+	/* Check that all granules are in NS state */
+	res = check_range_gpi(base, size, GPT_GPI_NS);
+	if (res != 0) {
+		VERBOSE("GPT: Only Granules in NS state can be delegated.\n");
+		unlock_range(base, size);
+		return res;
+	}
+
+	/* Remove any data speculatively fetched into the target PAS */
+	flush_range_to_popa(base | nse, size);
+
+	write_gpt_range(base, size, GPT_L1_NS_DESC, target_pas);
+
+	/* Ensure that all agents observe the new configuration */
+	tlbi_range_dsbosh(base, size);
+
+	nse = (uint64_t)GPT_NSE_NS << GPT_NSE_SHIFT;
+
+	/* Ensure that the scrubbed data have made it past the PoPA */
+	flush_range_to_popa(base | nse, size);
+
+#if (RME_GPT_MAX_BLOCK != 0)
+	fuse_range(base, size, l1_desc);
+#endif
+	unlock_range(base, size);
+
+	VERBOSE("GPT: Granules 0x%"PRIx64"-0x%"PRIx64" GPI 0x%x->0x%x\n",
+		base, base + size - 1UL, GPT_GPI_NS, target_pas);
+
+	return 0;
+}
+
+/*
+ * Helper to undelegate all granules in the range [base, base + size) to NS
+ * with a single lock acquisition. The steps are the ones of
+ * gpt_undelegate_pas(), with the cache maintenance and TLB invalidation
+ * done once for the whole range. No granule is transitioned if any of them
+ * is not in the caller's state.
+ */
+static int undelegate_range(uint64_t base, size_t size,
+			    unsigned int src_sec_state)
+{
+	uint64_t nse, l1_desc;
+	unsigned int gpi;
+	int res;
+
+	if (src_sec_state == SMC_FROM_REALM) {
+		gpi = GPT_GPI_REALM;
+		l1_desc = GPT_L1_REALM_DESC;
+		nse = (uint64_t)GPT_NSE_REALM << GPT_NSE_SHIFT;
+	} else if (src_sec_state == SMC_FROM_SECURE) {
+		gpi = GPT_GPI_SECURE;
+		l1_desc = GPT_L1_SECURE_DESC;
+		nse = (uint64_t)GPT_NSE_SECURE << GPT_NSE_SHIFT;
+	} else {
+		VERBOSE("GPT: Invalid caller security state 0x%x\n",
+							src_sec_state);
+		return -EPERM;
+	}
+
+	lock_range(base, size);
+
+	/* Check that all granules are in the delegated state */
+	res = check_range_gpi(base, size, gpi);
+	if (res != 0) {
+		VERBOSE("GPT: Only Granules in REALM or SECURE state can be undelegated\n");
+		unlock_range(base, size);
+		return res;
+	}
+
+	/* Remove access first, see gpt_undelegate_pas() */
+	write_gpt_range(base, size, l1_desc, GPT_GPI_NO_ACCESS);
+
+	/* Ensure that all agents observe the new NO_ACCESS configuration */
+	tlbi_range_dsbosh(base, size);
+
+	/* Ensure that the scrubbed data have made it past the PoPA */
+	flush_range_to_popa(base | nse, size);
+
+	/*
+	 * Remove any data loaded speculatively in NS space from before
+	 * the scrubbing.
+	 */
+	nse = (uint64_t)GPT_NSE_NS << GPT_NSE_SHIFT;
+
+	flush_range_to_popa(base | nse, size);
+
+	/* Clear existing GPI encoding and transition granules */
+	write_gpt_range(base, size, l1_desc, GPT_GPI_NS);
+
+	/* Ensure that all agents observe the new NS configuration */
+	tlbi_range_dsbosh(base, size);
+
+#if (RME_GPT_MAX_BLOCK != 0)
+	fuse_range(base, size, GPT_L1_NS_DESC);
+#endif
+	unlock_range(base, size);
+
+	VERBOSE("GPT: Granules 0x%"PRIx64"-0x%"PRIx64" GPI 0x%x->0x%x\n",
+		base, base + size - 1UL, gpi, GPT_GPI_NS);
+
+	return 0;
+}
+
+#if RME_GPT_STATS
+/*
+ * Get the counters of shattered and fused Contiguous descriptors, summed over
+ * all CPUs. Counters of other CPUs may be updated concurrently, so the sum is
+ * a snapshot.
+ *
+ * Parameters
+ *   stats		Pointer to 'gpt_stats_t' structure to fill out.
+ */
+static void gpt_get_stats(gpt_stats_t *stats)
+{
+	assert(stats != NULL);
+
+	zeromem(stats, sizeof(*stats));
+
+	for (unsigned int cpu = 0U; cpu < PLATFORM_CORE_COUNT; cpu++) {
+		for (unsigned int i = 0U; i < GPT_STATS_LEVELS; i++) {
+			stats->shatter[i] += gpt_stats[cpu].shatter[i];
+			stats->fuse[i] += gpt_stats[cpu].fuse[i];
+		}
+	}
+}
+
+/*
+ * Handler of the GPT statistics calls of the Vendor-Specific EL3 service.
+ */
+uintptr_t gpt_stats_smc_handler(unsigned int smc_fid,
+				u_register_t x1,
+				u_register_t x2,
+				u_register_t x3,
+				u_register_t x4,
+				void *cookie,
+				void *handle,
+				u_register_t flags)
+{
+	gpt_stats_t stats;
+
+	switch (smc_fid) {
+	case GPT_STATS_GET_64:
+		gpt_get_stats(&stats);
+
+		SMC_RET7(handle, SMC_OK,
+			 stats.shatter[GPT_STATS_2MB],
+			 stats.shatter[GPT_STATS_32MB],
+			 stats.shatter[GPT_STATS_512MB],
+			 stats.fuse[GPT_STATS_2MB],
+			 stats.fuse[GPT_STATS_32MB],
+			 stats.fuse[GPT_STATS_512MB]);
+
+	default:
+		WARN("Unimplemented GPT stats call: 0x%x\n", smc_fid);
+		SMC_RET1(handle, SMC_UNK);
+	}
+}
+#endif
+
 /*
  * This function is the granule transition delegate service. When a granule
  * transition request occurs it is routed to this function to have the request,
  * if valid, fulfilled following A1.1.1 Delegate of RME supplement.
  *
- * TODO: implement support for transitioning multiple granules at once.
+ * A range of granules is transitioned with a single lock acquisition, and
+ * either all the granules in the range are transitioned or none is.
  *
  * Parameters
  *   base		Base address of the region to transition, must be
@@ -1714,28 +2221,9 @@ int gpt_delegate_pas(uint64_t base, size_t size, unsigned int src_sec_state)
 	/* Ensure that caches are enabled */
 	assert((read_sctlr_el3() & SCTLR_C_BIT) != 0UL);
 
-	/* See if this is a single or a range of granule transition */
-	if (size != GPT_PGS_ACTUAL_SIZE(gpt_config.p)) {
-		return -EINVAL;
-	}
-
-	/* Check that base and size are valid */
-	if ((ULONG_MAX - base) < size) {
-		VERBOSE("GPT: Transition request address overflow!\n");
-		VERBOSE("      Base=0x%"PRIx64"\n", base);
-		VERBOSE("      Size=0x%lx\n", size);
-		return -EINVAL;
-	}
-
-	/* Make sure base and size are valid */
-	if (((base & (GPT_PGS_ACTUAL_SIZE(gpt_config.p) - 1UL)) != 0UL) ||
-	    ((size & (GPT_PGS_ACTUAL_SIZE(gpt_config.p) - 1UL)) != 0UL) ||
-	    (size == 0UL) ||
-	    ((base + size) >= GPT_PPS_ACTUAL_SIZE(gpt_config.t))) {
-		VERBOSE("GPT: Invalid granule transition address range!\n");
-		VERBOSE("      Base=0x%"PRIx64"\n", base);
-		VERBOSE("      Size=0x%lx\n", size);
-		return -EINVAL;
+	res = validate_transition_range(base, size);
+	if (res != 0) {
+		return res;
 	}
 
 	/* Delegate request can only come from REALM or SECURE */
@@ -1756,6 +2244,11 @@ int gpt_delegate_pas(uint64_t base, size_t size, unsigned int src_sec_state)
 		l1_desc = GPT_L1_SECURE_DESC;
 	}
 
+	/* See if this is a single or a range of granule transition */
+	if (size != GPT_PGS_ACTUAL_SIZE(gpt_config.p)) {
+		return delegate_range(base, size, target_pas, nse, l1_desc);
+	}
+
 	res = get_gpi_params(base, &gpi_info);
 	if (res != 0) {
 		return res;
@@ -1828,7 +2321,8 @@ int gpt_delegate_pas(uint64_t base, size_t size, unsigned int src_sec_state)
  * transition request occurs it is routed to this function where the request is
  * validated then fulfilled if possible.
  *
- * TODO: implement support for transitioning multiple granules at once.
+ * A range of granules is transitioned with a single lock acquisition, and
+ * either all the granules in the range are transitioned or none is.
  *
  * Parameters
  *   base		Base address of the region to transition, must be
@@ -1852,28 +2346,14 @@ int gpt_undelegate_pas(uint64_t base, size_t size, unsigned int src_sec_state)
 	/* Ensure that MMU and caches are enabled */
 	assert((read_sctlr_el3() & SCTLR_C_BIT) != 0UL);
 
-	/* See if this is a single or a range of granule transition */
-	if (size != GPT_PGS_ACTUAL_SIZE(gpt_config.p)) {
-		return -EINVAL;
-	}
-
-	/* Check that base and size are valid */
-	if ((ULONG_MAX - base) < size) {
-		VERBOSE("GPT: Transition request address overflow!\n");
-		VERBOSE("      Base=0x%"PRIx64"\n", base);
-		VERBOSE("      Size=0x%lx\n", size);
-		return -EINVAL;
+	res = validate_transition_range(base, size);
+	if (res != 0) {
+		return res;
 	}
 
-	/* Make sure base and size are valid */
-	if (((base & (GPT_PGS_ACTUAL_SIZE(gpt_config.p) - 1UL)) != 0UL) ||
-	    ((size & (GPT_PGS_ACTUAL_SIZE(gpt_config.p) - 1UL)) != 0UL) ||
-	    (size == 0UL) ||
-	    ((base + size) >= GPT_PPS_ACTUAL_SIZE(gpt_config.t))) {
-		VERBOSE("GPT: Invalid granule transition address range!\n");
-		VERBOSE("      Base=0x%"PRIx64"\n", base);
-		VERBOSE("      Size=0x%lx\n", size);
-		return -EINVAL;
+	/* See if this is a single or a range of granule transition */
+	if (size != GPT_PGS_ACTUAL_SIZE(gpt_config.p)) {
+		return undelegate_range(base, size, src_sec_state);
 	}
 
 	res = get_gpi_params(base, &gpi_info);
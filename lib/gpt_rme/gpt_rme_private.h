@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, Arm Limited. All rights reserved.
+ * Copyright (c) 2022-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -357,4 +357,21 @@ typedef struct {
 /* Get 2MB block number in 32MB block: 0-15 */
 #define GET_2MB_NUM(_addr)	((_addr >> 21) & 0xF)
 
+#if RME_GPT_STATS
+/* Indexes of 2MB, 32MB and 512MB blocks in gpt_stats_t arrays */
+#define GPT_STATS_2MB			U(0)
+#define GPT_STATS_32MB			U(1)
+#define GPT_STATS_512MB			U(2)
+#define GPT_STATS_LEVELS		U(3)
+
+/*
+ * Number of Contiguous descriptors shattered to Granules descriptors on
+ * granule transitions and fused back from them, per block size.
+ */
+typedef struct gpt_stats {
+	uint64_t shatter[GPT_STATS_LEVELS];
+	uint64_t fuse[GPT_STATS_LEVELS];
+} gpt_stats_t;
+#endif
+
 #endif /* GPT_RME_PRIVATE_H */
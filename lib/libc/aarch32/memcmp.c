@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Word type allowed to alias any object */
+typedef uint32_t __attribute__((__may_alias__)) word_t;
+
+#define WORD_MASK	(sizeof(word_t) - 1U)
+
+/*
+ * Skip equal words when 's1' and 's2' have the same alignment, then locate
+ * the first differing byte, if any, a byte at a time.
+ */
+int memcmp(const void *s1, const void *s2, size_t len)
+{
+	const unsigned char *s = s1;
+	const unsigned char *d = s2;
+	unsigned char sc;
+	unsigned char dc;
+
+	if ((((uintptr_t)s ^ (uintptr_t)d) & WORD_MASK) == 0U) {
+		while ((((uintptr_t)s & WORD_MASK) != 0U) && (len != 0U)) {
+			sc = *s++;
+			dc = *d++;
+			if (sc - dc)
+				return (sc - dc);
+			len--;
+		}
+
+		while ((len >= sizeof(word_t)) &&
+		       (*(const word_t *)s == *(const word_t *)d)) {
+			s += sizeof(word_t);
+			d += sizeof(word_t);
+			len -= sizeof(word_t);
+		}
+	}
+
+	while (len--) {
+		sc = *s++;
+		dc = *d++;
+		if (sc - dc)
+			return (sc - dc);
+	}
+
+	return 0;
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Word type allowed to alias any object */
+typedef uint32_t __attribute__((__may_alias__)) word_t;
+
+#define WORD_MASK	(sizeof(word_t) - 1U)
+
+/*
+ * Copy a word at a time when 'src' and 'dst' have the same alignment, so
+ * that only aligned accesses are performed, and a byte at a time otherwise.
+ */
+void *memcpy(void *dst, const void *src, size_t len)
+{
+	const char *s = src;
+	char *d = dst;
+
+	if ((((uintptr_t)d ^ (uintptr_t)s) & WORD_MASK) == 0U) {
+		while ((((uintptr_t)d & WORD_MASK) != 0U) && (len != 0U)) {
+			*d++ = *s++;
+			len--;
+		}
+
+		while (len >= (4U * sizeof(word_t))) {
+			word_t *dw = (word_t *)d;
+			const word_t *sw = (const word_t *)s;
+
+			dw[0] = sw[0];
+			dw[1] = sw[1];
+			dw[2] = sw[2];
+			dw[3] = sw[3];
+			d += 4U * sizeof(word_t);
+			s += 4U * sizeof(word_t);
+			len -= 4U * sizeof(word_t);
+		}
+
+		while (len >= sizeof(word_t)) {
+			*(word_t *)d = *(const word_t *)s;
+			d += sizeof(word_t);
+			s += sizeof(word_t);
+			len -= sizeof(word_t);
+		}
+	}
+
+	while (len--)
+		*d++ = *s++;
+
+	return dst;
+}
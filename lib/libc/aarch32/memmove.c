@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Word type allowed to alias any object */
+typedef uint32_t __attribute__((__may_alias__)) word_t;
+
+#define WORD_MASK	(sizeof(word_t) - 1U)
+
+void *memmove(void *dst, const void *src, size_t len)
+{
+	/*
+	 * The following test makes use of unsigned arithmetic overflow to
+	 * more efficiently test the condition !(src <= dst && dst < str+len).
+	 * See lib/libc/memmove.c.
+	 */
+	if ((size_t)dst - (size_t)src >= len) {
+		/* destination not in source data, so can safely use memcpy */
+		return memcpy(dst, src, len);
+	} else {
+		/* copy backwards, a word at a time when mutually aligned */
+		const char *s = (const char *)src + len;
+		char *d = (char *)dst + len;
+
+		if ((((uintptr_t)d ^ (uintptr_t)s) & WORD_MASK) == 0U) {
+			while ((((uintptr_t)d & WORD_MASK) != 0U) &&
+			       (len != 0U)) {
+				*--d = *--s;
+				len--;
+			}
+
+			while (len >= sizeof(word_t)) {
+				d -= sizeof(word_t);
+				s -= sizeof(word_t);
+				*(word_t *)d = *(const word_t *)s;
+				len -= sizeof(word_t);
+			}
+		}
+
+		while (len--)
+			*--d = *--s;
+	}
+	return dst;
+}
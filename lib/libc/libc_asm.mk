@@ -1,15 +1,28 @@
 #
-# Copyright (c) 2020-2024, Arm Limited. All rights reserved.
+# Copyright (c) 2020-2026, Arm Limited. All rights reserved.
 #
 # SPDX-License-Identifier: BSD-3-Clause
 #
 
 include lib/libc/libc_common.mk
 
+# Replace the byte-wise C versions of memcpy, memmove and memcmp
+LIBC_SRCS	:=	$(filter-out $(addprefix lib/libc/,	\
+				memcmp.c			\
+				memcpy.c			\
+				memmove.c),			\
+			$(LIBC_SRCS))
+
 ifeq (${ARCH},aarch64)
 LIBC_SRCS	+=	$(addprefix lib/libc/aarch64/,	\
+			memcmp.S			\
+			memcpy.S			\
+			memmove.S			\
 			memset.S)
 else
 LIBC_SRCS	+=	$(addprefix lib/libc/aarch32/,	\
+			memcmp.c			\
+			memcpy.c			\
+			memmove.c			\
 			memset.S)
 endif
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2018, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -10,6 +10,7 @@
 #include <arch_helpers.h>
 #include <lib/bakery_lock.h>
 #include <lib/el3_runtime/cpu_data.h>
+#include <lib/lock_stats.h>
 #include <plat/common/platform.h>
 
 /*
@@ -94,6 +95,10 @@ void bakery_lock_get(bakery_lock_t *bakery)
 	unsigned int they, me;
 	unsigned int my_ticket, my_prio, their_ticket;
 	unsigned int their_bakery_data;
+#if LOCK_STATS
+	uint64_t start = read_cntpct_el0();
+	bool contended = false;
+#endif
 
 	me = plat_my_core_pos();
 
@@ -129,6 +134,9 @@ void bakery_lock_get(bakery_lock_t *bakery)
 			 * to have it dropped to 0; or drop and probably content
 			 * again for the same lock to have an even higher value)
 			 */
+#if LOCK_STATS
+			contended = true;
+#endif
 			do {
 				wfe();
 			} while (their_ticket ==
@@ -142,6 +150,13 @@ void bakery_lock_get(bakery_lock_t *bakery)
 	 * acquired.
 	 */
 	dmbish();
+
+#if LOCK_STATS
+	/* Lock statistics are kept in cacheable memory */
+	if (is_dcache_enabled()) {
+		lock_stats_acquired(bakery, start, contended);
+	}
+#endif
 }
 
 
@@ -153,6 +168,12 @@ void bakery_lock_release(bakery_lock_t *bakery)
 	assert_bakery_entry_valid(me, bakery);
 	assert(bakery_ticket_number(bakery->lock_data[me]) != 0U);
 
+#if LOCK_STATS
+	if (is_dcache_enabled()) {
+		lock_stats_released(bakery);
+	}
+#endif
+
 	/*
 	 * Ensure that other observers see any stores in the critical section
 	 * before releasing the lock. Also ensure all loads in the critical
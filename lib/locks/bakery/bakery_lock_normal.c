@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2020, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  * Copyright (c) 2020, NVIDIA Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
@@ -11,6 +11,7 @@
 #include <arch_helpers.h>
 #include <lib/bakery_lock.h>
 #include <lib/el3_runtime/cpu_data.h>
+#include <lib/lock_stats.h>
 #include <lib/utils_def.h>
 #include <plat/common/platform.h>
 
@@ -169,6 +170,10 @@ void bakery_lock_get(bakery_lock_t *lock)
 	bakery_info_t *their_bakery_info;
 	unsigned int their_bakery_data;
 	bool is_cached;
+#if LOCK_STATS
+	uint64_t start = read_cntpct_el0();
+	bool contended = false;
+#endif
 
 	me = plat_my_core_pos();
 	is_cached = is_dcache_enabled();
@@ -210,6 +215,9 @@ void bakery_lock_get(bakery_lock_t *lock)
 			 * to have it dropped to 0; or drop and probably content
 			 * again for the same lock to have an even higher value)
 			 */
+#if LOCK_STATS
+			contended = true;
+#endif
 			do {
 				wfe();
 				read_cache_op((uintptr_t)their_bakery_info, is_cached);
@@ -224,6 +232,13 @@ void bakery_lock_get(bakery_lock_t *lock)
 	 * acquired.
 	 */
 	dmbish();
+
+#if LOCK_STATS
+	/* Lock statistics are kept in cacheable memory */
+	if (is_cached) {
+		lock_stats_acquired(lock, start, contended);
+	}
+#endif
 }
 
 void bakery_lock_release(bakery_lock_t *lock)
@@ -235,6 +250,12 @@ void bakery_lock_release(bakery_lock_t *lock)
 
 	assert(is_lock_acquired(my_bakery_info, is_cached));
 
+#if LOCK_STATS
+	if (is_cached) {
+		lock_stats_released(lock);
+	}
+#endif
+
 	/*
 	 * Ensure that other observers see any stores in the critical section
 	 * before releasing the lock. Also ensure all loads in the critical
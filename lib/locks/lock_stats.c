@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <arch_helpers.h>
+#include <common/debug.h>
+#include <common/runtime_svc.h>
+#include <lib/cassert.h>
+#include <lib/lock_stats.h>
+#include <lib/spinlock.h>
+#include <smccc_helpers.h>
+
+/*
+ * The statistics of a lock are found on each acquisition and release through
+ * an open addressing hash table of the lock addresses. The table is kept at
+ * most half full, so lookups take one or two probes. Its entries hold the index
+ * of the statistics plus one, 0 for a free entry.
+ */
+#define LOCK_STATS_HASH_SIZE	((LOCK_STATS_MAX * 2U) + 1U)
+
+static lock_stats_t lock_stats[LOCK_STATS_MAX];
+static uint16_t lock_stats_hash[LOCK_STATS_HASH_SIZE];
+static unsigned int lock_stats_count;
+
+CASSERT(LOCK_STATS_MAX < UINT16_MAX, assert_lock_stats_max_fits_hash);
+
+static unsigned int lock_stats_hash_idx(const void *lock)
+{
+	/* Locks are at least 4 bytes apart */
+	return (unsigned int)(((uintptr_t)lock >> 2) % LOCK_STATS_HASH_SIZE);
+}
+
+static lock_stats_t *lock_stats_find(const void *lock)
+{
+	unsigned int h = lock_stats_hash_idx(lock);
+	unsigned int slot;
+
+	/* The table is never full, so a free entry ends the search */
+	for (;;) {
+		slot = lock_stats_hash[h];
+		if (slot == 0U) {
+			return NULL;
+		}
+
+		if (lock_stats[slot - 1U].lock == lock) {
+			return &lock_stats[slot - 1U];
+		}
+
+		h = (h + 1U) % LOCK_STATS_HASH_SIZE;
+	}
+}
+
+int lock_stats_register(const void *lock, const char *name, unsigned int id)
+{
+	unsigned int h;
+
+	assert(lock != NULL);
+	assert(name != NULL);
+
+	if (lock_stats_find(lock) != NULL) {
+		return 0;
+	}
+
+	if (lock_stats_count == LOCK_STATS_MAX) {
+		WARN("Lock stats: no space for lock %s%u\n", name, id);
+		return -ENOMEM;
+	}
+
+	lock_stats[lock_stats_count].name = name;
+	lock_stats[lock_stats_count].id = id;
+	lock_stats[lock_stats_count].lock = lock;
+	lock_stats_count++;
+
+	h = lock_stats_hash_idx(lock);
+	while (lock_stats_hash[h] != 0U) {
+		h = (h + 1U) % LOCK_STATS_HASH_SIZE;
+	}
+
+	/* Make the entry visible before it can be found */
+	dmbish();
+	lock_stats_hash[h] = (uint16_t)lock_stats_count;
+
+	return 0;
+}
+
+void lock_stats_acquired(const void *lock, uint64_t start, bool contended)
+{
+	lock_stats_t *stats = lock_stats_find(lock);
+	uint64_t now, wait;
+
+	if (stats == NULL) {
+		return;
+	}
+
+	now = read_cntpct_el0();
+	wait = now - start;
+
+	stats->acquired++;
+	if (contended) {
+		stats->contended++;
+	}
+
+	stats->wait_total += wait;
+	if (wait > stats->wait_max) {
+		stats->wait_max = wait;
+	}
+
+	stats->hold_start = now;
+}
+
+void lock_stats_released(const void *lock)
+{
+	lock_stats_t *stats = lock_stats_find(lock);
+	uint64_t hold;
+
+	if (stats == NULL) {
+		return;
+	}
+
+	hold = read_cntpct_el0() - stats->hold_start;
+	if (hold > stats->hold_max) {
+		stats->hold_max = hold;
+	}
+}
+
+/*
+ * Check whether a spinlock is held. This is only used to count contended
+ * acquisitions, so the result does not need to be exact.
+ */
+static bool is_spin_locked(const spinlock_t *lock)
+{
+	uint32_t val = lock->lock;
+
+#if USE_SPINLOCK_TICKET
+	/* Next ticket differs from owner ticket */
+	return (val >> 16) != (val & 0xffffU);
+#else
+	return val != 0U;
+#endif
+}
+
+/*
+ * Wrappers of spin_lock() and spin_unlock(), which the spin lock functions
+ * are redirected to. The plain functions are called with their name in
+ * parentheses to bypass the redirection.
+ */
+void lock_stats_spin_lock(spinlock_t *lock)
+{
+	uint64_t start = read_cntpct_el0();
+	bool contended = is_spin_locked(lock);
+
+	(spin_lock)(lock);
+
+	/* Lock statistics are kept in cacheable memory */
+	if (is_dcache_enabled()) {
+		lock_stats_acquired(lock, start, contended);
+	}
+}
+
+void lock_stats_spin_unlock(spinlock_t *lock)
+{
+	if (is_dcache_enabled()) {
+		lock_stats_released(lock);
+	}
+
+	(spin_unlock)(lock);
+}
+
+/*
+ * Get a copy of the statistics of the lock at index 'idx'. The copy is made
+ * without taking the lock, so it may be slightly inconsistent.
+ */
+int lock_stats_get(unsigned int idx, lock_stats_t *stats)
+{
+	assert(stats != NULL);
+
+	if (idx >= lock_stats_count) {
+		return -EINVAL;
+	}
+
+	*stats = lock_stats[idx];
+
+	return 0;
+}
+
+void lock_stats_dump(void)
+{
+	lock_stats_t stats;
+
+	printf("Lock statistics (system counter at %lu Hz):\n",
+	       read_cntfrq_el0());
+
+	for (unsigned int i = 0U; i < lock_stats_count; i++) {
+		(void)lock_stats_get(i, &stats);
+
+		printf("%u: %s%u (%p) acquired %llu contended %llu\n", i,
+		       stats.name, stats.id, stats.lock,
+		       (unsigned long long)stats.acquired,
+		       (unsigned long long)stats.contended);
+		printf("    wait avg %llu max %llu hold max %llu\n",
+		       (unsigned long long)((stats.acquired != 0U) ?
+				(stats.wait_total / stats.acquired) : 0U),
+		       (unsigned long long)stats.wait_max,
+		       (unsigned long long)stats.hold_max);
+	}
+}
+
+uintptr_t lock_stats_smc_handler(unsigned int smc_fid,
+				 u_register_t x1,
+				 u_register_t x2,
+				 u_register_t x3,
+				 u_register_t x4,
+				 void *cookie,
+				 void *handle,
+				 u_register_t flags)
+{
+	lock_stats_t stats;
+
+	switch (smc_fid) {
+#if DEBUG
+	/* Printing the whole table is slow, do not let release builds do it */
+	case LOCK_STATS_DUMP_32:
+		lock_stats_dump();
+		SMC_RET2(handle, SMC_OK, lock_stats_count);
+#endif /* DEBUG */
+
+	case LOCK_STATS_GET_64:
+		if ((x1 > UINT32_MAX) ||
+		    (lock_stats_get((unsigned int)x1, &stats) != 0)) {
+			SMC_RET1(handle, SMC_INVALID_PARAM);
+		}
+
+		SMC_RET6(handle, SMC_OK, stats.acquired, stats.contended,
+			 (stats.acquired != 0U) ?
+				(stats.wait_total / stats.acquired) : 0U,
+			 stats.wait_max, stats.hold_max);
+
+	default:
+		WARN("Unimplemented lock stats call: 0x%x\n", smc_fid);
+		SMC_RET1(handle, SMC_UNK);
+	}
+}
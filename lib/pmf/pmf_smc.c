@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2016-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -25,6 +25,9 @@ uintptr_t pmf_smc_handler(unsigned int smc_fid,
 {
 	int rc;
 	unsigned long long ts_value;
+#if ENABLE_SMC_STATS
+	uint64_t words[6];
+#endif
 
 	/* Determine if the cpu exists of not */
 	if (!is_valid_mpidr(x2))
@@ -70,6 +73,21 @@ uintptr_t pmf_smc_handler(unsigned int smc_fid,
 		if (smc_fid == PMF_SMC_GET_VERSION_64) {
 			SMC_RET2(handle, SMC_OK, PMF_SMC_VERSION);
 		}
+
+#if ENABLE_SMC_STATS
+		if (smc_fid == PMF_SMC_GET_SMC_STATS_64) {
+			/*
+			 * Return error code and part of the SMC statistics
+			 * entry x1 of the CPU x2, starting at word x3.
+			 * x0 --> error code.
+			 * x1 - x6 --> words of the entry.
+			 */
+			rc = pmf_get_smc_stats_smc((unsigned int)x1, x2,
+					(unsigned int)x3, words);
+			SMC_RET7(handle, rc, words[0], words[1], words[2],
+					words[3], words[4], words[5]);
+		}
+#endif /* ENABLE_SMC_STATS */
 	}
 
 	WARN("Unimplemented PMF Call: 0x%x \n", smc_fid);
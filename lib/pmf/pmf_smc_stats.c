@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <stdint.h>
+
+#include <arch_helpers.h>
+#include <lib/el3_runtime/cpu_data.h>
+#include <lib/pmf/pmf.h>
+#include <lib/psci/psci.h>
+#include <lib/smccc.h>
+#include <plat/common/platform.h>
+
+#include <platform_def.h>
+
+#define PMF_SMC_STATS_WORDS	(sizeof(struct pmf_smc_stats) / sizeof(uint64_t))
+
+CASSERT(PMF_SMC_STATS_ENTRIES >= 2, assert_pmf_smc_stats_entries_too_small);
+CASSERT((sizeof(struct pmf_smc_stats) % sizeof(uint64_t)) == 0U,
+	assert_pmf_smc_stats_size_mismatch);
+
+/*
+ * Each CPU only updates its own table, so no locking is needed. A table is an
+ * open-addressed hash table indexed by function ID, except for the last entry
+ * which collects the calls that could not be given an entry.
+ */
+struct pmf_smc_stats pmf_smc_stats[PLATFORM_CORE_COUNT][PMF_SMC_STATS_ENTRIES];
+
+static struct pmf_smc_stats *pmf_smc_stats_find(struct pmf_smc_stats *table,
+						uint32_t smc_fid)
+{
+	unsigned int nr_slots = PMF_SMC_STATS_ENTRIES - 1U;
+	unsigned int slot, i;
+
+	/* Mix the function number with the owning entity and call type */
+	slot = (smc_fid ^ (smc_fid >> FUNCID_OEN_SHIFT)) % nr_slots;
+
+	for (i = 0U; i < nr_slots; i++) {
+		if (table[slot].valid == 0U) {
+			table[slot].fid = smc_fid;
+			table[slot].valid = 1U;
+			return &table[slot];
+		}
+
+		if (table[slot].fid == smc_fid) {
+			return &table[slot];
+		}
+
+		slot = (slot + 1U == nr_slots) ? 0U : slot + 1U;
+	}
+
+	table[nr_slots].fid = PMF_SMC_STATS_FID_OTHER;
+	table[nr_slots].valid = 1U;
+
+	return &table[nr_slots];
+}
+
+/*
+ * Account for an SMC handled by the runtime service dispatcher. Called from
+ * the SMC exception path once the handler has returned, using the exception
+ * entry timestamp captured by the runtime instrumentation.
+ */
+void pmf_smc_stats_record(uint32_t smc_fid)
+{
+	struct pmf_smc_stats *stats;
+	uint64_t ticks;
+	unsigned int bucket;
+
+	ticks = read_cntpct_el0() -
+		get_cpu_data(cpu_data_pmf_ts[CPU_DATA_PMF_TS0_IDX]);
+
+	stats = pmf_smc_stats_find(pmf_smc_stats[plat_my_core_pos()], smc_fid);
+
+	bucket = (ticks == 0U) ? 0U : 63U - (unsigned int)__builtin_clzll(ticks);
+	if (bucket >= PMF_SMC_STATS_BUCKETS) {
+		bucket = PMF_SMC_STATS_BUCKETS - 1U;
+	}
+
+	stats->count++;
+	stats->total_ticks += ticks;
+	if (ticks > stats->max_ticks) {
+		stats->max_ticks = ticks;
+	}
+	stats->buckets[bucket]++;
+}
+
+/*
+ * Copy six 64-bit words of the statistics entry 'idx' of the CPU 'mpidr',
+ * starting at word 'offset'. Words past the end of the entry read as zero.
+ */
+int pmf_get_smc_stats_smc(unsigned int idx,
+		u_register_t mpidr,
+		unsigned int offset,
+		uint64_t words[6])
+{
+	const uint64_t *entry;
+	int core_pos;
+	unsigned int i;
+
+	core_pos = plat_core_pos_by_mpidr(mpidr);
+	if ((core_pos < 0) || (idx >= PMF_SMC_STATS_ENTRIES) ||
+	    (offset >= PMF_SMC_STATS_WORDS)) {
+		return PSCI_E_INVALID_PARAMS;
+	}
+
+	entry = (const uint64_t *)&pmf_smc_stats[core_pos][idx];
+	for (i = 0U; i < 6U; i++) {
+		words[i] = ((offset + i) < PMF_SMC_STATS_WORDS) ?
+			   entry[offset + i] : 0U;
+	}
+
+	return PSCI_E_SUCCESS;
+}
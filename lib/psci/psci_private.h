@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -14,6 +14,7 @@
 #include <common/bl_common.h>
 #include <lib/bakery_lock.h>
 #include <lib/el3_runtime/cpu_data.h>
+#include <lib/lock_stats.h>
 #include <lib/psci/psci.h>
 #include <lib/spinlock.h>
 
@@ -260,6 +261,7 @@ static inline void psci_lock_init(non_cpu_pd_node_t *non_cpu_pd_node,
 				  uint16_t idx)
 {
 	non_cpu_pd_node[idx].lock_index = idx;
+	(void)lock_stats_register(&psci_locks[idx], "psci", idx);
 }
 
 /*******************************************************************************
@@ -1,5 +1,5 @@
 #
-# Copyright (c) 2022-2024, Arm Limited. All rights reserved.
+# Copyright (c) 2022-2026, Arm Limited. All rights reserved.
 #
 # SPDX-License-Identifier: BSD-3-Clause
 #
@@ -237,6 +237,9 @@ ENABLE_FEAT_CSV2_2			?=	0
 # SCXTNUM_ELx register.
 ENABLE_FEAT_CSV2_3			?=	0
 
+# Flag to enable the use of the SHA-256 instructions for hash calculations.
+ENABLE_FEAT_SHA256			?=	0
+
 # By default, disable access of trace system registers from NS lower
 # ELs  i.e. NS-EL2, or NS-EL1 if NS-EL2 implemented but unused if
 # system register trace is implemented. This feature is available if
@@ -248,6 +251,9 @@ ENABLE_SYS_REG_TRACE_FOR_NS		?=	0
 # 8.2
 #----
 
+# Flag to enable the use of the SHA-512 instructions for hash calculations.
+ENABLE_FEAT_SHA512			?=	0
+
 # Build option to enable/disable the Statistical Profiling Extension,
 # keep it enabled by default for AArch64.
 ifeq (${ARCH},aarch64)
@@ -1,5 +1,5 @@
 #
-# Copyright (c) 2016-2024, Arm Limited. All rights reserved.
+# Copyright (c) 2016-2026, Arm Limited. All rights reserved.
 #
 # SPDX-License-Identifier: BSD-3-Clause
 #
@@ -39,9 +39,18 @@ BL2_ENABLE_SP_LOAD		:= 0
 # when RESET_TO_BL2 is 1.
 BL2_IN_XIP_MEM			:= 0
 
+# Run the post-load handling of an image once the next image is loaded, so that
+# its authentication overlaps with that load. Requires BL2_PARALLEL_AUTH.
+BL2_DEFER_POST_IMAGE_LOAD	:= 0
+
 # Do dcache invalidate upon BL2 entry at EL3
 BL2_INV_DCACHE			:= 1
 
+# Authenticate images on the secondary CPUs while BL2 loads the next ones, this
+# option is only supported when RESET_TO_BL2 is 1 and requires
+# BL2_DEFER_POST_IMAGE_LOAD.
+BL2_PARALLEL_AUTH		:= 0
+
 # Select the branch protection features to use.
 BRANCH_PROTECTION		:= 0
 
@@ -82,6 +91,9 @@ DISABLE_BIN_GENERATION		:= 0
 # development platforms.
 DYN_DISABLE_AUTH		:= 0
 
+# Flag to enable lock contention statistics in BL31
+ENABLE_LOCK_STATS		:= 0
+
 # Enable the Maximum Power Mitigation Mechanism on supporting cores.
 ENABLE_MPMM			:= 0
 
@@ -100,6 +112,12 @@ ENABLE_PSCI_STAT		:= 0
 # Flag to enable runtime instrumentation using PMF
 ENABLE_RUNTIME_INSTRUMENTATION	:= 0
 
+# Flag to enable the SMC batch interface in the vendor-specific EL3 service
+ENABLE_SMC_BATCH		:= 0
+
+# Flag to enable per-SMC latency statistics in PMF
+ENABLE_SMC_STATS		:= 0
+
 # Flag to enable stack corruption protection
 ENABLE_STACK_PROTECTOR		:= 0
 
@@ -148,6 +166,9 @@ RME_GPT_BITLOCK_BLOCK		:= 1
 # Default maximum size of GPT contiguous block
 RME_GPT_MAX_BLOCK		:= 512
 
+# Counters of shattered and fused GPT contiguous blocks
+RME_GPT_STATS			:= 0
+
 # Hint platform interrupt control layer that Group 0 interrupts are for EL3. By
 # default, they are for Secure EL1.
 GICV2_G0_FOR_EL3		:= 0
@@ -317,6 +338,11 @@ SANITIZE_UB := off
 # Default: disabled
 USE_SPINLOCK_CAS := 0
 
+# Enabling this option selects the ticket spinlock implementation variant, which
+# grants the lock to contending CPUs in first-come, first-served order.
+# Default: disabled
+USE_SPINLOCK_TICKET := 0
+
 # Enable Link Time Optimization
 ENABLE_LTO			:= 0
 
@@ -326,6 +352,10 @@ ENABLE_LTO			:= 0
 # CTX_INCLUDE_EL2_REGS.
 CTX_INCLUDE_EL2_REGS		:= 0
 
+# Only write the groups of EL2 registers whose values differ from the context
+# they were last saved to, when restoring the EL2 context of a world.
+CTX_EL2_LAZY_RESTORE		:= 0
+
 # Enable Memory tag extension which is supported for architecture greater
 # than Armv8.5-A
 # By default it is set to "no"
@@ -1,10 +1,16 @@
 /*
- * Copyright (c) 2017, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <assert.h>
+
+#include <arch_helpers.h>
+#include <drivers/arm/fvp/fvp_pwrc.h>
+#include <plat/arm/common/arm_config.h>
 #include <plat/arm/common/plat_arm.h>
+#include <platform_def.h>
 
 #include "fvp_private.h"
 
@@ -28,3 +34,69 @@ void bl2_el3_early_platform_setup(u_register_t arg0 __unused,
 	 */
 	fvp_interconnect_enable();
 }
+
+#if BL2_PARALLEL_AUTH
+/*
+ * Release the other CPUs of the primary CPU's cluster so that they help with
+ * authenticating images. The other clusters are left in their holding pen as
+ * they have not been made coherent in the interconnect yet.
+ */
+int bl2_el3_plat_release_secondaries(uintptr_t entrypoint)
+{
+	uintptr_t *mailbox = (void *)PLAT_ARM_TRUSTED_MAILBOX_BASE;
+	u_register_t my_mpidr = read_mpidr_el1() & MPIDR_AFFINITY_MASK;
+	u_register_t mpidr;
+	unsigned int cpu, thread, psysr;
+	int count = 0;
+
+	assert((PLAT_ARM_TRUSTED_MAILBOX_BASE >= ARM_SHARED_RAM_BASE) &&
+		((PLAT_ARM_TRUSTED_MAILBOX_BASE + sizeof(*mailbox)) <=
+				(ARM_SHARED_RAM_BASE + ARM_SHARED_RAM_SIZE)));
+
+	*mailbox = entrypoint;
+	flush_dcache_range((uintptr_t)mailbox, sizeof(*mailbox));
+
+	for (cpu = 0U; cpu < FVP_MAX_CPUS_PER_CLUSTER; cpu++) {
+		for (thread = 0U; thread < FVP_MAX_PE_PER_CPU; thread++) {
+			if ((arm_config.flags & ARM_CONFIG_FVP_SHIFTED_AFF) != 0U) {
+				mpidr = (my_mpidr & (MPIDR_AFFLVL_MASK <<
+						     MPIDR_AFF2_SHIFT)) |
+					((u_register_t)cpu << MPIDR_AFF1_SHIFT) |
+					((u_register_t)thread << MPIDR_AFF0_SHIFT);
+			} else if (thread == 0U) {
+				mpidr = (my_mpidr & (MPIDR_AFFLVL_MASK <<
+						     MPIDR_AFF1_SHIFT)) |
+					((u_register_t)cpu << MPIDR_AFF0_SHIFT);
+			} else {
+				continue;
+			}
+
+			if (mpidr == my_mpidr) {
+				continue;
+			}
+
+			psysr = fvp_pwrc_read_psysr(mpidr);
+			if (psysr == PSYSR_INVALID) {
+				continue;
+			}
+
+			/*
+			 * The CPU may still be on its way to the holding pen.
+			 * Wait for it to power off, as powering it on before
+			 * would leave it in a zombie wfi.
+			 */
+			while ((psysr & PSYSR_AFF_L0) != 0U) {
+				psysr = fvp_pwrc_read_psysr(mpidr);
+			}
+
+			fvp_pwrc_write_pponr(mpidr);
+			count++;
+		}
+	}
+
+	dsbsy();
+	sev();
+
+	return count;
+}
+#endif /* BL2_PARALLEL_AUTH */
@@ -564,3 +564,31 @@ void __init bl31_plat_arch_setup(void)
 {
 	arm_bl31_plat_arch_setup();
 }
+
+#if ENABLE_SMC_BATCH
+/*
+ * Check that a buffer registered through the SMC batch interface lies entirely
+ * within the Non-secure DRAM.
+ */
+int plat_smc_batch_validate_buf(unsigned long long pa, size_t size)
+{
+	unsigned long long end = pa + size;
+
+	if ((size == 0U) || (end < pa)) {
+		return -1;
+	}
+
+	if ((pa >= ARM_NS_DRAM1_BASE) &&
+	    (end <= (ARM_NS_DRAM1_BASE + ARM_NS_DRAM1_SIZE))) {
+		return 0;
+	}
+#ifdef __aarch64__
+	if ((pa >= ARM_DRAM2_BASE) &&
+	    (end <= (ARM_DRAM2_BASE + ARM_DRAM2_SIZE))) {
+		return 0;
+	}
+#endif
+
+	return -1;
+}
+#endif /* ENABLE_SMC_BATCH */
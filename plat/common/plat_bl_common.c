@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -20,6 +20,7 @@
  * may redefine with strong definition.
  */
 #pragma weak bl2_el3_plat_prepare_exit
+#pragma weak bl2_el3_plat_release_secondaries
 #pragma weak plat_error_handler
 #pragma weak bl2_plat_preload_setup
 #pragma weak bl2_plat_handle_pre_image_load
@@ -48,6 +49,11 @@ void bl2_el3_plat_prepare_exit(void)
 {
 }
 
+int bl2_el3_plat_release_secondaries(uintptr_t entrypoint __unused)
+{
+	return 0;
+}
+
 void __dead2 plat_error_handler(int err)
 {
 	while (1)
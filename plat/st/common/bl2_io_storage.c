@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -70,6 +70,8 @@ static io_block_dev_spec_t mmc_block_dev_spec = {
 		.write = NULL,
 	},
 	.block_size = MMC_BLOCK_SIZE,
+	/* SDMMC2 selects DMA or polling depending on the destination */
+	.direct_io = true,
 };
 
 static const io_dev_connector_t *mmc_dev_con;
@@ -80,6 +82,8 @@ static io_mtd_dev_spec_t spi_nor_dev_spec = {
 	.ops = {
 		.init = spi_nor_init,
 		.read = spi_nor_read,
+		.dirmap_enable = spi_nor_dirmap_enable,
+		.dirmap_disable = spi_nor_dirmap_disable,
 	},
 };
 #endif
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -14,6 +14,7 @@
 #include <common/desc_image_load.h>
 #include <drivers/generic_delay_timer.h>
 #include <drivers/mmc.h>
+#include <drivers/spi_nor.h>
 #include <drivers/st/bsec.h>
 #include <drivers/st/regulator_fixed.h>
 #include <drivers/st/stm32_iwdg.h>
@@ -545,5 +546,10 @@ void bl2_el3_plat_prepare_exit(void)
 	}
 #endif /* STM32MP_UART_PROGRAMMER || STM32MP_USB_PROGRAMMER */
 
+#if STM32MP_SPI_NOR
+	/* Do not hand the QSPI over in memory-mapped mode */
+	spi_nor_dirmap_disable();
+#endif /* STM32MP_SPI_NOR */
+
 	stm32mp1_security_setup();
 }
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <common/debug.h>
+#include <common/runtime_svc.h>
+#include <lib/pmf/pmf.h>
+#include <lib/psci/psci.h>
+#include <lib/spinlock.h>
+#include <lib/xlat_tables/xlat_tables_v2.h>
+#include <plat/common/platform.h>
+#include <services/arm_arch_svc.h>
+#include <services/smc_batch.h>
+#include <services/trng_svc.h>
+#include <services/ven_el3_svc.h>
+#include <smccc_helpers.h>
+
+#include <platform_def.h>
+
+/* Per-CPU batch buffer, mapped on registration */
+static struct smc_batch_buf {
+	unsigned long long pa;
+	uintptr_t va;
+} smc_batch_bufs[PLATFORM_CORE_COUNT];
+
+/* Serialises updates of the translation tables */
+static spinlock_t smc_batch_map_lock;
+
+/*
+ * Return true if a call can be made from a batch. The call must return to the
+ * caller without switching world, powering down the CPU or changing the state
+ * of EL3, so only the fast calls listed here are allowed.
+ */
+static bool smc_batch_is_allowed(uint32_t smc_fid)
+{
+	if ((GET_SMC_TYPE(smc_fid) != SMC_TYPE_FAST) ||
+	    ((smc_fid & (FUNCID_FC_RESERVED_MASK <<
+			 FUNCID_FC_RESERVED_SHIFT)) != 0U)) {
+		return false;
+	}
+
+	switch (GET_SMC_OEN(smc_fid)) {
+	case OEN_ARM_START:
+		/* Arm Architecture queries, SiP calls are never allowed */
+		switch (smc_fid) {
+		case SMCCC_VERSION:
+		case SMCCC_ARCH_FEATURES:
+		case SMCCC_ARCH_SOC_ID:
+			return true;
+		default:
+			return false;
+		}
+	case OEN_VEN_EL3_START:
+		switch (smc_fid) {
+		case VEN_EL3_SVC_UID:
+		case VEN_EL3_SVC_VERSION:
+#if ENABLE_PMF
+		case PMF_SMC_GET_TIMESTAMP_32:
+		case PMF_SMC_GET_TIMESTAMP_64:
+		case PMF_SMC_GET_VERSION_32:
+		case PMF_SMC_GET_VERSION_64:
+#endif /* ENABLE_PMF */
+			return true;
+		default:
+			return false;
+		}
+	case OEN_STD_START:
+#if TRNG_SUPPORT
+		if (is_trng_fid(smc_fid)) {
+			return true;
+		}
+#endif /* TRNG_SUPPORT */
+		/* PSCI queries, which never change the power state */
+		switch (smc_fid) {
+		case PSCI_VERSION:
+		case PSCI_FEATURES:
+		case PSCI_AFFINITY_INFO_AARCH32:
+		case PSCI_AFFINITY_INFO_AARCH64:
+		case PSCI_MIG_INFO_TYPE:
+		case PSCI_NODE_HW_STATE_AARCH32:
+		case PSCI_NODE_HW_STATE_AARCH64:
+		case PSCI_STAT_RESIDENCY_AARCH32:
+		case PSCI_STAT_RESIDENCY_AARCH64:
+		case PSCI_STAT_COUNT_AARCH32:
+		case PSCI_STAT_COUNT_AARCH64:
+			return true;
+		default:
+			return false;
+		}
+	default:
+		return false;
+	}
+}
+
+/* Map the batch buffer of the calling CPU */
+static int smc_batch_register(struct smc_batch_buf *buf,
+			      unsigned long long pa)
+{
+	uintptr_t va;
+	int ret;
+
+	if ((pa & (PAGE_SIZE_4KB - 1U)) != 0U) {
+		return SMC_INVALID_PARAM;
+	}
+
+	/*
+	 * EL3 takes a fault when accessing anything else than Non-secure
+	 * memory through a non-secure mapping, so only accept buffers that the
+	 * platform reports to be in Non-secure DRAM.
+	 */
+	if (plat_smc_batch_validate_buf(pa, PAGE_SIZE_4KB) != 0) {
+		return SMC_INVALID_PARAM;
+	}
+
+	spin_lock(&smc_batch_map_lock);
+
+	if (buf->va != 0U) {
+		(void)mmap_remove_dynamic_region(buf->va, PAGE_SIZE_4KB);
+		buf->va = 0U;
+	}
+
+	/*
+	 * The buffer is always accessed through a non-secure mapping, so it
+	 * cannot be used to reach secure memory.
+	 */
+	ret = mmap_add_dynamic_region_alloc_va(pa, &va, PAGE_SIZE_4KB,
+					       MT_MEMORY | MT_RW | MT_NS |
+					       MT_EXECUTE_NEVER);
+	if (ret == 0) {
+		buf->pa = pa;
+		buf->va = va;
+	} else {
+		WARN("SMC batch: failed to map buffer 0x%llx (%d)\n", pa, ret);
+	}
+
+	spin_unlock(&smc_batch_map_lock);
+
+	return (ret == 0) ? SMC_OK : SMC_INVALID_PARAM;
+}
+
+/*
+ * Run the calls of a batch buffer through the runtime service dispatcher, one
+ * after the other, using the caller's context to pass the arguments and
+ * results. Each entry is copied to secure memory before being used.
+ */
+static unsigned int smc_batch_execute(struct smc_batch_buf *buf,
+				      unsigned int count, void *cookie,
+				      void *handle, u_register_t flags)
+{
+	struct smc_batch_entry *entries = (struct smc_batch_entry *)buf->va;
+	gp_regs_t *gpregs = get_gpregs_ctx(handle);
+	struct smc_batch_entry entry;
+	unsigned int i, r;
+
+	for (i = 0U; i < count; i++) {
+		entry = entries[i];
+
+		if (!smc_batch_is_allowed((uint32_t)entry.regs[0])) {
+			entries[i].regs[0] = SMC_UNK;
+			continue;
+		}
+
+		for (r = 0U; r < ARRAY_SIZE(entry.regs); r++) {
+			write_ctx_reg(gpregs, CTX_GPREG_X0 + (r << 3),
+				      entry.regs[r]);
+		}
+
+		(void)handle_runtime_svc((uint32_t)entry.regs[0], cookie,
+					 handle, (unsigned int)flags);
+
+		for (r = 0U; r < ARRAY_SIZE(entry.regs); r++) {
+			entry.regs[r] = read_ctx_reg(gpregs,
+						     CTX_GPREG_X0 + (r << 3));
+		}
+		entries[i] = entry;
+	}
+
+	return i;
+}
+
+/*
+ * This function handles the SMC batch calls.
+ */
+uintptr_t smc_batch_handler(unsigned int smc_fid,
+			    u_register_t x1,
+			    u_register_t x2,
+			    u_register_t x3,
+			    u_register_t x4,
+			    void *cookie,
+			    void *handle,
+			    u_register_t flags)
+{
+	struct smc_batch_buf *buf = &smc_batch_bufs[plat_my_core_pos()];
+	u_register_t x5, x6, x7;
+	unsigned int count;
+	int ret;
+
+	/* Allow calls from non-secure only */
+	if (is_caller_secure(flags)) {
+		SMC_RET1(handle, SMC_DENIED);
+	}
+
+	switch (smc_fid) {
+	case SMC_BATCH_VERSION_32:
+	case SMC_BATCH_VERSION_64:
+		SMC_RET2(handle, SMC_OK, SMC_BATCH_VERSION);
+
+	case SMC_BATCH_REGISTER_64:
+		ret = smc_batch_register(buf, x1);
+		SMC_RET1(handle, ret);
+
+	case SMC_BATCH_EXECUTE_64:
+		if (buf->va == 0U) {
+			SMC_RET1(handle, SMC_DENIED);
+		}
+		if (x1 > SMC_BATCH_MAX_ENTRIES) {
+			SMC_RET1(handle, SMC_INVALID_PARAM);
+		}
+
+		/* Preserve the registers not used to return results */
+		x5 = SMC_GET_GP(handle, CTX_GPREG_X5);
+		x6 = SMC_GET_GP(handle, CTX_GPREG_X6);
+		x7 = SMC_GET_GP(handle, CTX_GPREG_X7);
+
+		count = smc_batch_execute(buf, (unsigned int)x1, cookie,
+					  handle, flags);
+
+		SMC_RET8(handle, SMC_OK, count, x2, x3, x4, x5, x6, x7);
+
+	default:
+		break;
+	}
+
+	WARN("Unimplemented SMC batch call: 0x%x\n", smc_fid);
+	SMC_RET1(handle, SMC_UNK);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2024-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -9,7 +9,10 @@
 #include <common/debug.h>
 #include <common/runtime_svc.h>
 #include <lib/debugfs.h>
+#include <lib/gpt_rme/gpt_rme.h>
+#include <lib/lock_stats.h>
 #include <lib/pmf/pmf.h>
+#include <services/smc_batch.h>
 #include <services/ven_el3_svc.h>
 #include <tools_share/uuid.h>
 
@@ -71,6 +74,39 @@ static uintptr_t ven_el3_svc_handler(unsigned int smc_fid,
 
 #endif /* ENABLE_PMF */
 
+#if ENABLE_SMC_BATCH
+	/*
+	 * Dispatch SMC batch calls to the SMC batch handler and return its
+	 * return value.
+	 */
+	if (is_smc_batch_fid(smc_fid)) {
+		return smc_batch_handler(smc_fid, x1, x2, x3, x4, cookie,
+				handle, flags);
+	}
+#endif /* ENABLE_SMC_BATCH */
+
+#if LOCK_STATS
+	/*
+	 * Dispatch lock statistics calls to the lock statistics handler and
+	 * return its return value.
+	 */
+	if (is_lock_stats_fid(smc_fid)) {
+		return lock_stats_smc_handler(smc_fid, x1, x2, x3, x4, cookie,
+				handle, flags);
+	}
+#endif /* LOCK_STATS */
+
+#if ENABLE_RME && RME_GPT_STATS
+	/*
+	 * Dispatch GPT statistics calls to the GPT statistics handler and
+	 * return its return value.
+	 */
+	if (is_gpt_stats_fid(smc_fid)) {
+		return gpt_stats_smc_handler(smc_fid, x1, x2, x3, x4, cookie,
+				handle, flags);
+	}
+#endif /* ENABLE_RME && RME_GPT_STATS */
+
 	switch (smc_fid) {
 	case VEN_EL3_SVC_UID:
 		/* Return UID to the caller */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024 Arm Limited. All rights reserved.
+ * Copyright (c) 2022-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier:    BSD-3-Clause
  *
@@ -522,6 +522,7 @@ static void drtm_dl_reset_dlme_el_state(enum drtm_dlme_el dlme_el)
 		break;
 
 	case DLME_AT_EL2:
+		cm_el2_sysregs_live_invalidate();
 		write_sctlr_el2(sctlr);
 		break;
 	}
@@ -543,6 +544,7 @@ static void drtm_dl_reset_dlme_context(enum drtm_dlme_el dlme_el)
 		break;
 
 	case DLME_AT_EL2:
+		cm_el2_sysregs_live_invalidate();
 		write_sp_el2(0);
 		break;
 	}
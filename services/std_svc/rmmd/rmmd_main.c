@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2021-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -36,6 +36,18 @@
 #include "rmmd_initial_context.h"
 #include "rmmd_private.h"
 
+/*******************************************************************************
+ * Largest range transitioned by a single RMM_GTSI_DELEGATE_RANGE or
+ * RMM_GTSI_UNDELEGATE_RANGE call, to bound the time spent with the GPT locked.
+ ******************************************************************************/
+#ifndef PLAT_RMMD_GTSI_RANGE_MAX_SIZE
+#define PLAT_RMMD_GTSI_RANGE_MAX_SIZE	(U(2) * U(1024) * U(1024))
+#endif
+
+CASSERT(((PLAT_RMMD_GTSI_RANGE_MAX_SIZE % PAGE_SIZE_4KB) == 0U) &&
+	(PLAT_RMMD_GTSI_RANGE_MAX_SIZE != 0U),
+	assert_rmmd_gtsi_range_max_size);
+
 /*******************************************************************************
  * RMM boot failure flag
  ******************************************************************************/
@@ -449,6 +461,7 @@ uint64_t rmmd_rmm_el3_handler(uint32_t smc_fid, uint64_t x1, uint64_t x2,
 				void *handle, uint64_t flags)
 {
 	uint32_t src_sec_state;
+	uint64_t size;
 	int ret;
 
 	/* If RMM failed to boot, treat any RMM-EL3 interface SMC as unknown */
@@ -472,6 +485,16 @@ uint64_t rmmd_rmm_el3_handler(uint32_t smc_fid, uint64_t x1, uint64_t x2,
 	case RMM_GTSI_UNDELEGATE:
 		ret = gpt_undelegate_pas(x1, PAGE_SIZE_4KB, SMC_FROM_REALM);
 		SMC_RET1(handle, gpt_to_gts_error(ret, smc_fid, x1));
+	case RMM_GTSI_DELEGATE_RANGE:
+		size = MIN(x2, (uint64_t)PLAT_RMMD_GTSI_RANGE_MAX_SIZE);
+		ret = gpt_delegate_pas(x1, size, SMC_FROM_REALM);
+		SMC_RET2(handle, gpt_to_gts_error(ret, smc_fid, x1),
+			 (ret == 0) ? size : 0UL);
+	case RMM_GTSI_UNDELEGATE_RANGE:
+		size = MIN(x2, (uint64_t)PLAT_RMMD_GTSI_RANGE_MAX_SIZE);
+		ret = gpt_undelegate_pas(x1, size, SMC_FROM_REALM);
+		SMC_RET2(handle, gpt_to_gts_error(ret, smc_fid, x1),
+			 (ret == 0) ? size : 0UL);
 	case RMM_ATTEST_GET_PLAT_TOKEN:
 		ret = rmmd_attest_get_platform_token(x1, &x2, x3);
 		SMC_RET2(handle, ret, x2);
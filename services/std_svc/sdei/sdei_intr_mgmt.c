@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -682,6 +682,7 @@ int sdei_event_complete(bool resume, uint64_t pc)
 		 * call.
 		 */
 		if (client_el == MODE_EL2) {
+			cm_el2_sysregs_live_invalidate();
 			write_elr_el2(disp_ctx->elr_el3);
 			write_spsr_el2(disp_ctx->spsr_el3);
 		} else {
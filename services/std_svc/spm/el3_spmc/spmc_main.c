@@ -2271,6 +2271,12 @@ int32_t spmc_setup(void)
 	}
 	memset(spmc_shmem_obj_state.data, 0, spmc_shmem_obj_state.data_size);
 
+	ret = spmc_shmem_obj_state_init(&spmc_shmem_obj_state);
+	if (ret != 0) {
+		ERROR("Failed to initialize memory descriptor backing store!\n");
+		return ret;
+	}
+
 	/* Setup logical SPs. */
 	ret = logical_sp_init();
 	if (ret != 0) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2022-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -9,6 +9,7 @@
 
 #include <common/debug.h>
 #include <common/runtime_svc.h>
+#include <lib/lock_stats.h>
 #include <lib/object_pool.h>
 #include <lib/spinlock.h>
 #include <lib/xlat_tables/xlat_tables_v2.h>
@@ -24,15 +25,59 @@
  * @desc_filled:    Size of @desc already received.
  * @in_use:         Number of clients that have called ffa_mem_retrieve_req
  *                  without a matching ffa_mem_relinquish call.
+ * @size:           Size of this object in the backing store.
+ * @prev_size:      Size of the previous object in the backing store, 0 if
+ *                  this is the first one. Bit 0 is set if this object is on a
+ *                  free list, as object sizes are multiples of 8.
  * @desc:           FF-A memory region descriptor passed in ffa_mem_share.
+ *                  Holds a struct spmc_shmem_free_link for free objects.
+ *
+ * The allocator fields are packed so that the header is no larger than when
+ * objects were kept contiguous.
  */
 struct spmc_shmem_obj {
 	size_t desc_size;
-	size_t desc_filled;
-	size_t in_use;
+	uint32_t desc_filled;
+	uint32_t in_use;
+	uint32_t size;
+	uint32_t prev_size;
 	struct ffa_mtd desc;
 };
 
+#define SPMC_SHMEM_OBJ_FREE		U(1)
+
+/* Object sizes must leave bit 0 of @prev_size free for SPMC_SHMEM_OBJ_FREE. */
+CASSERT((offsetof(struct spmc_shmem_obj, desc) % 8U) == 0U,
+	assert_spmc_shmem_obj_header_size_alignment);
+
+/**
+ * struct spmc_shmem_free_link - Free list links of a free object.
+ * @next:           Next object in the same free list.
+ * @prev:           Previous object in the same free list.
+ */
+struct spmc_shmem_free_link {
+	struct spmc_shmem_obj *next;
+	struct spmc_shmem_obj *prev;
+};
+
+static bool spmc_shmem_obj_is_free(const struct spmc_shmem_obj *obj)
+{
+	return (obj->prev_size & SPMC_SHMEM_OBJ_FREE) != 0U;
+}
+
+static uint32_t spmc_shmem_obj_prev_size(const struct spmc_shmem_obj *obj)
+{
+	return obj->prev_size & ~SPMC_SHMEM_OBJ_FREE;
+}
+
+/* Set the size of the previous object, keeping the free flag of @obj. */
+static void spmc_shmem_obj_set_prev_size(struct spmc_shmem_obj *obj,
+					 size_t prev_size)
+{
+	obj->prev_size = (uint32_t)prev_size |
+			 (obj->prev_size & SPMC_SHMEM_OBJ_FREE);
+}
+
 /*
  * Declare our data structure to store the metadata of memory share requests.
  * The main datastore is allocated on a per platform basis to ensure enough
@@ -57,21 +102,360 @@ static size_t spmc_shmem_obj_size(size_t desc_size)
 	return desc_size + offsetof(struct spmc_shmem_obj, desc);
 }
 
+/* Smallest object, which must be able to hold the free list links. */
+#define SPMC_SHMEM_OBJ_MIN_BLOCK	\
+	spmc_shmem_obj_size(sizeof(struct spmc_shmem_free_link))
+
+/*
+ * Smallest object that can be assigned a handle, used to bound the number of
+ * entries needed in the handle index.
+ */
+#define SPMC_SHMEM_OBJ_MIN_SIZE	\
+	spmc_shmem_obj_size(sizeof(struct ffa_mtd_v1_0))
+
+/**
+ * spmc_shmem_obj_state_init - Set up the handle index of the backing store.
+ * @state:      Global state, with @state->data and @state->data_size set and
+ *              the backing store zeroed.
+ *
+ * The index is carved from the end of the backing store and has at least one
+ * more entry than the number of objects that can be assigned a handle, so it
+ * can never fill up.
+ *
+ * Return: 0 on success, -ENOMEM if the backing store is too small.
+ */
+int spmc_shmem_obj_state_init(struct spmc_shmem_obj_state *state)
+{
+	size_t max_objs = state->data_size / SPMC_SHMEM_OBJ_MIN_SIZE;
+	size_t slots = 1U;
+	uintptr_t index_base;
+
+	/* Object offsets and sizes are stored on 32 bits. */
+	if (state->data_size > UINT32_MAX) {
+		state->data_size = UINT32_MAX;
+	}
+
+	while (slots <= max_objs) {
+		slots <<= 1;
+	}
+
+	index_base = round_down((uintptr_t)state->data + state->data_size -
+				(slots * sizeof(*state->index)),
+				sizeof(*state->index));
+	if ((slots * sizeof(*state->index) >= state->data_size) ||
+	    (index_base < (uintptr_t)state->data)) {
+		ERROR("%s: backing store too small\n", __func__);
+		return -ENOMEM;
+	}
+
+	state->index = (uint32_t *)index_base;
+	state->index_slots = slots;
+	state->index_count = 0U;
+	state->data_size = index_base - (uintptr_t)state->data;
+
+	(void)lock_stats_register(&state->lock, "spmc_shmem", 0U);
+
+	return 0;
+}
+
+/**
+ * spmc_shmem_obj_index_hash - Get the preferred index entry for a handle.
+ * @state:      Global state.
+ * @handle:     Handle to hash.
+ *
+ * Handles are allocated sequentially, so folding them is enough to spread
+ * them over the index.
+ *
+ * Return: Position in @state->index.
+ */
+static size_t spmc_shmem_obj_index_hash(struct spmc_shmem_obj_state *state,
+					uint64_t handle)
+{
+	return (size_t)(handle ^ (handle >> 32)) & (state->index_slots - 1U);
+}
+
+/**
+ * spmc_shmem_obj_index_at - Get the object referenced by an index entry.
+ * @state:      Global state.
+ * @pos:        Position in @state->index of a used entry.
+ *
+ * Return: Pointer to the object.
+ */
+static struct spmc_shmem_obj *
+spmc_shmem_obj_index_at(struct spmc_shmem_obj_state *state, size_t pos)
+{
+	return (struct spmc_shmem_obj *)(state->data + state->index[pos] - 1U);
+}
+
+/**
+ * spmc_shmem_obj_index_find - Find the index entry of a handle.
+ * @state:      Global state.
+ * @handle:     Handle to look for.
+ * @pos:        Set to the position of the entry holding @handle if found, or
+ *              of the free entry where it would be inserted otherwise.
+ *
+ * Return: true if @handle is in the index.
+ */
+static bool spmc_shmem_obj_index_find(struct spmc_shmem_obj_state *state,
+				      uint64_t handle, size_t *pos)
+{
+	size_t i = spmc_shmem_obj_index_hash(state, handle);
+
+	while (state->index[i] != 0U) {
+		if (spmc_shmem_obj_index_at(state, i)->desc.handle == handle) {
+			*pos = i;
+			return true;
+		}
+		i = (i + 1U) & (state->index_slots - 1U);
+	}
+
+	*pos = i;
+	return false;
+}
+
+/**
+ * spmc_shmem_obj_index_add - Make a handle refer to an object.
+ * @state:      Global state.
+ * @obj:        Object, with its handle set. If the handle is already in the
+ *              index, it is updated to refer to @obj.
+ *
+ * Return: 0 on success, -ENOMEM if the index is full.
+ */
+static int spmc_shmem_obj_index_add(struct spmc_shmem_obj_state *state,
+				    struct spmc_shmem_obj *obj)
+{
+	size_t pos;
+
+	if (!spmc_shmem_obj_index_find(state, obj->desc.handle, &pos)) {
+		/* Always keep a free entry to terminate searches. */
+		if (state->index_count + 1U >= state->index_slots) {
+			return -ENOMEM;
+		}
+		state->index_count++;
+	}
+	state->index[pos] = (uint32_t)((uint8_t *)obj - state->data) + 1U;
+
+	return 0;
+}
+
+/**
+ * spmc_shmem_obj_index_remove - Remove an object from the index.
+ * @state:      Global state.
+ * @obj:        Object to remove. Nothing is done if its handle does not
+ *              refer to it, e.g. for temporary copies of a descriptor.
+ *
+ * Entries following the removed one are moved back so that no search is
+ * terminated early, which avoids the need for tombstones.
+ */
+static void spmc_shmem_obj_index_remove(struct spmc_shmem_obj_state *state,
+					struct spmc_shmem_obj *obj)
+{
+	size_t mask = state->index_slots - 1U;
+	size_t hole;
+	size_t i;
+
+	if (!spmc_shmem_obj_index_find(state, obj->desc.handle, &hole) ||
+	    (spmc_shmem_obj_index_at(state, hole) != obj)) {
+		return;
+	}
+
+	i = hole;
+	for (;;) {
+		size_t home;
+
+		i = (i + 1U) & mask;
+		if (state->index[i] == 0U) {
+			break;
+		}
+
+		/* Move the entry if the hole is between its home and it. */
+		home = spmc_shmem_obj_index_hash(state,
+				spmc_shmem_obj_index_at(state, i)->desc.handle);
+		if (((i - home) & mask) >= ((i - hole) & mask)) {
+			state->index[hole] = state->index[i];
+			hole = i;
+		}
+	}
+
+	state->index[hole] = 0U;
+	state->index_count--;
+}
+
+/**
+ * spmc_shmem_free_class - Get the free list used for objects of a size.
+ * @size:       Object size.
+ *
+ * Return: Index in @state->free_list, objects in list n are at least
+ *         (64 << n) bytes, except for list 0.
+ */
+static unsigned int spmc_shmem_free_class(size_t size)
+{
+	unsigned int class = 0U;
+
+	size >>= 6;
+	while ((size > 1U) && (class < (SPMC_SHMEM_FREE_CLASSES - 1U))) {
+		size >>= 1;
+		class++;
+	}
+
+	return class;
+}
+
+static struct spmc_shmem_free_link *
+spmc_shmem_obj_free_link(struct spmc_shmem_obj *obj)
+{
+	return (struct spmc_shmem_free_link *)&obj->desc;
+}
+
+/**
+ * spmc_shmem_obj_next - Get the object following another in the backing store.
+ * @state:      Global state.
+ * @obj:        Object.
+ *
+ * Return: The next object, or %NULL if @obj is the last one.
+ */
+static struct spmc_shmem_obj *
+spmc_shmem_obj_next(struct spmc_shmem_obj_state *state,
+		    struct spmc_shmem_obj *obj)
+{
+	uint8_t *next = (uint8_t *)obj + obj->size;
+
+	if ((size_t)(next - state->data) >= state->allocated) {
+		return NULL;
+	}
+	return (struct spmc_shmem_obj *)next;
+}
+
+/**
+ * spmc_shmem_free_list_add - Add an object to its free list.
+ * @state:      Global state.
+ * @obj:        Object, with its size set.
+ */
+static void spmc_shmem_free_list_add(struct spmc_shmem_obj_state *state,
+				     struct spmc_shmem_obj *obj)
+{
+	unsigned int class = spmc_shmem_free_class(obj->size);
+	struct spmc_shmem_free_link *link = spmc_shmem_obj_free_link(obj);
+
+	obj->prev_size |= SPMC_SHMEM_OBJ_FREE;
+	link->prev = NULL;
+	link->next = state->free_list[class];
+	if (link->next != NULL) {
+		spmc_shmem_obj_free_link(link->next)->prev = obj;
+	}
+	state->free_list[class] = obj;
+#if DEBUG
+	state->free_bytes += obj->size;
+	state->free_count++;
+#endif
+}
+
+/**
+ * spmc_shmem_free_list_remove - Remove an object from its free list.
+ * @state:      Global state.
+ * @obj:        Free object.
+ */
+static void spmc_shmem_free_list_remove(struct spmc_shmem_obj_state *state,
+					struct spmc_shmem_obj *obj)
+{
+	struct spmc_shmem_free_link *link = spmc_shmem_obj_free_link(obj);
+
+	if (link->prev != NULL) {
+		spmc_shmem_obj_free_link(link->prev)->next = link->next;
+	} else {
+		state->free_list[spmc_shmem_free_class(obj->size)] = link->next;
+	}
+	if (link->next != NULL) {
+		spmc_shmem_obj_free_link(link->next)->prev = link->prev;
+	}
+	obj->prev_size &= ~SPMC_SHMEM_OBJ_FREE;
+#if DEBUG
+	state->free_bytes -= obj->size;
+	state->free_count--;
+#endif
+}
+
+/**
+ * spmc_shmem_free_list_take - Take a free object large enough for a size.
+ * @state:      Global state.
+ * @obj_size:   Required object size.
+ *
+ * The free list of the size class of @obj_size is searched first, then the
+ * first object of any larger class is used, as it is always large enough.
+ *
+ * Return: Object removed from its free list, or %NULL if there is none.
+ */
+static struct spmc_shmem_obj *
+spmc_shmem_free_list_take(struct spmc_shmem_obj_state *state, size_t obj_size)
+{
+	unsigned int class = spmc_shmem_free_class(obj_size);
+	struct spmc_shmem_obj *obj;
+
+	for (obj = state->free_list[class]; obj != NULL;
+	     obj = spmc_shmem_obj_free_link(obj)->next) {
+		if (obj->size >= obj_size) {
+			break;
+		}
+	}
+
+	while ((obj == NULL) && (++class < SPMC_SHMEM_FREE_CLASSES)) {
+		obj = state->free_list[class];
+	}
+
+	if (obj != NULL) {
+		spmc_shmem_free_list_remove(state, obj);
+	}
+	return obj;
+}
+
+#if DEBUG && (LOG_LEVEL >= LOG_LEVEL_VERBOSE)
+/**
+ * spmc_shmem_obj_dump_stats - Print fragmentation statistics.
+ * @state:      Global state.
+ *
+ * Called with the lock of @state held, each time an object is reclaimed.
+ */
+static void spmc_shmem_obj_dump_stats(struct spmc_shmem_obj_state *state)
+{
+	size_t largest = 0U;
+	unsigned int class;
+	struct spmc_shmem_obj *obj;
+
+	for (class = 0U; class < SPMC_SHMEM_FREE_CLASSES; class++) {
+		for (obj = state->free_list[class]; obj != NULL;
+		     obj = spmc_shmem_obj_free_link(obj)->next) {
+			largest = MAX(largest, (size_t)obj->size);
+		}
+	}
+
+	VERBOSE("shmem: 0x%zx/0x%zx bytes used, 0x%zx in %zu free objects, "
+		"largest 0x%zx, 0x%zx unused at the end\n",
+		state->allocated - state->free_bytes, state->data_size,
+		state->free_bytes, state->free_count, largest,
+		state->data_size - state->allocated);
+}
+#endif /* DEBUG && (LOG_LEVEL >= LOG_LEVEL_VERBOSE) */
+
 /**
  * spmc_shmem_obj_alloc - Allocate struct spmc_shmem_obj.
  * @state:      Global state.
  * @desc_size:  Size of struct ffa_memory_region_descriptor object that
  *              allocated object will hold.
  *
+ * A free object of a large enough size class is reused if possible, and split
+ * if the remainder can hold another object. Otherwise the object is taken from
+ * the unused space at the end of the backing store.
+ *
  * Return: Pointer to newly allocated object, or %NULL if there not enough space
- *         left. The returned pointer is only valid while @state is locked, to
- *         used it again after unlocking @state, spmc_shmem_obj_lookup must be
- *         called.
+ *         left. Objects are never moved, so the returned pointer stays valid
+ *         until the object is freed, but it must only be used while @state is
+ *         locked.
  */
 static struct spmc_shmem_obj *
 spmc_shmem_obj_alloc(struct spmc_shmem_obj_state *state, size_t desc_size)
 {
 	struct spmc_shmem_obj *obj;
+	struct spmc_shmem_obj *next;
 	size_t free = state->data_size - state->allocated;
 	size_t obj_size;
 
@@ -96,17 +480,46 @@ spmc_shmem_obj_alloc(struct spmc_shmem_obj_state *state, size_t desc_size)
 		return NULL;
 	}
 
-	if (obj_size > free) {
-		WARN("%s(0x%zx) failed, free 0x%zx\n",
-		     __func__, desc_size, free);
-		return NULL;
+	obj_size = MAX(obj_size, SPMC_SHMEM_OBJ_MIN_BLOCK);
+
+	obj = spmc_shmem_free_list_take(state, obj_size);
+	if (obj != NULL) {
+		/* Split the free object if the remainder is large enough. */
+		if ((obj->size - obj_size) >= SPMC_SHMEM_OBJ_MIN_BLOCK) {
+			struct spmc_shmem_obj *rem;
+
+			rem = (struct spmc_shmem_obj *)((uint8_t *)obj +
+							obj_size);
+			rem->size = obj->size - obj_size;
+			rem->prev_size = obj_size;
+			obj->size = obj_size;
+
+			next = spmc_shmem_obj_next(state, rem);
+			if (next != NULL) {
+				spmc_shmem_obj_set_prev_size(next, rem->size);
+			} else {
+				state->last_size = rem->size;
+			}
+			spmc_shmem_free_list_add(state, rem);
+		}
+	} else {
+		if (obj_size > free) {
+			WARN("%s(0x%zx) failed, free 0x%zx\n",
+			     __func__, desc_size, free);
+			return NULL;
+		}
+		obj = (struct spmc_shmem_obj *)(state->data + state->allocated);
+		obj->size = obj_size;
+		obj->prev_size = state->last_size;
+		state->allocated += obj_size;
+		state->last_size = obj_size;
 	}
-	obj = (struct spmc_shmem_obj *)(state->data + state->allocated);
-	obj->desc = (struct ffa_mtd) {0};
+
+	/* Only clear the descriptor space owned by the object. */
+	(void)memset(&obj->desc, 0, MIN(desc_size, sizeof(obj->desc)));
 	obj->desc_size = desc_size;
 	obj->desc_filled = 0;
 	obj->in_use = 0;
-	state->allocated += obj_size;
 	return obj;
 }
 
@@ -115,26 +528,47 @@ spmc_shmem_obj_alloc(struct spmc_shmem_obj_state *state, size_t desc_size)
  * @state:      Global state.
  * @obj:        Object to free.
  *
- * Release memory used by @obj. Other objects may move, so on return all
- * pointers to struct spmc_shmem_obj object should be considered invalid, not
- * just @obj.
- *
- * The current implementation always compacts the remaining objects to simplify
- * the allocator and to avoid fragmentation.
+ * Release memory used by @obj. Other objects are not moved. The freed object is
+ * merged with its free neighbours, and returned to the unused space at the end
+ * of the backing store if it is the last object, so the cost does not depend
+ * on the number of allocated objects.
  */
 
 static void spmc_shmem_obj_free(struct spmc_shmem_obj_state *state,
 				  struct spmc_shmem_obj *obj)
 {
-	size_t free_size = spmc_shmem_obj_size(obj->desc_size);
-	uint8_t *shift_dest = (uint8_t *)obj;
-	uint8_t *shift_src = shift_dest + free_size;
-	size_t shift_size = state->allocated - (shift_src - state->data);
+	struct spmc_shmem_obj *next;
+
+	spmc_shmem_obj_index_remove(state, obj);
+
+	/* Merge with the next object if it is free. */
+	next = spmc_shmem_obj_next(state, obj);
+	if ((next != NULL) && spmc_shmem_obj_is_free(next)) {
+		spmc_shmem_free_list_remove(state, next);
+		obj->size += next->size;
+	}
+
+	/* Merge with the previous object if it is free. */
+	if (spmc_shmem_obj_prev_size(obj) != 0U) {
+		struct spmc_shmem_obj *prev = (struct spmc_shmem_obj *)
+			((uint8_t *)obj - spmc_shmem_obj_prev_size(obj));
 
-	if (shift_size != 0U) {
-		memmove(shift_dest, shift_src, shift_size);
+		if (spmc_shmem_obj_is_free(prev)) {
+			spmc_shmem_free_list_remove(state, prev);
+			prev->size += obj->size;
+			obj = prev;
+		}
+	}
+
+	next = spmc_shmem_obj_next(state, obj);
+	if (next == NULL) {
+		/* Last object, give it back to the unused space. */
+		state->allocated -= obj->size;
+		state->last_size = spmc_shmem_obj_prev_size(obj);
+	} else {
+		spmc_shmem_obj_set_prev_size(next, obj->size);
+		spmc_shmem_free_list_add(state, obj);
 	}
-	state->allocated -= free_size;
 }
 
 /**
@@ -148,17 +582,12 @@ static void spmc_shmem_obj_free(struct spmc_shmem_obj_state *state,
 static struct spmc_shmem_obj *
 spmc_shmem_obj_lookup(struct spmc_shmem_obj_state *state, uint64_t handle)
 {
-	uint8_t *curr = state->data;
-
-	while (curr - state->data < state->allocated) {
-		struct spmc_shmem_obj *obj = (struct spmc_shmem_obj *)curr;
+	size_t pos;
 
-		if (obj->desc.handle == handle) {
-			return obj;
-		}
-		curr += spmc_shmem_obj_size(obj->desc_size);
+	if (!spmc_shmem_obj_index_find(state, handle, &pos)) {
+		return NULL;
 	}
-	return NULL;
+	return spmc_shmem_obj_index_at(state, pos);
 }
 
 /**
@@ -173,14 +602,15 @@ spmc_shmem_obj_lookup(struct spmc_shmem_obj_state *state, uint64_t handle)
 static struct spmc_shmem_obj *
 spmc_shmem_obj_get_next(struct spmc_shmem_obj_state *state, size_t *offset)
 {
-	uint8_t *curr = state->data + *offset;
-
-	if (curr - state->data < state->allocated) {
-		struct spmc_shmem_obj *obj = (struct spmc_shmem_obj *)curr;
+	while (*offset < state->allocated) {
+		struct spmc_shmem_obj *obj =
+			(struct spmc_shmem_obj *)(state->data + *offset);
 
-		*offset += spmc_shmem_obj_size(obj->desc_size);
+		*offset += obj->size;
 
-		return obj;
+		if (!spmc_shmem_obj_is_free(obj)) {
+			return obj;
+		}
 	}
 	return NULL;
 }
@@ -632,8 +1062,6 @@ spmc_shm_convert_mtd_to_v1_0(struct spmc_shmem_obj *out_obj,
  *                  descriptor.
  *
  * Return: 0 if conversion and population succeeded.
- * Note: This function invalidates the reference to @orig therefore
- * `spmc_shmem_obj_lookup` must be called if further usage is required.
  */
 static uint32_t
 spmc_populate_ffa_v1_0_descriptor(void *dst, struct spmc_shmem_obj *orig_obj,
@@ -669,11 +1097,7 @@ spmc_populate_ffa_v1_0_descriptor(void *dst, struct spmc_shmem_obj *orig_obj,
 		*copy_size = MIN(v1_0_obj->desc_size - offset, buf_size);
 		memcpy(dst, (uint8_t *) &v1_0_obj->desc + offset, *copy_size);
 
-		/*
-		 * We're finished with the v1.0 descriptor for now so free it.
-		 * Note that this will invalidate any references to the v1.1
-		 * descriptor.
-		 */
+		/* We're finished with the v1.0 descriptor for now so free it. */
 		spmc_shmem_obj_free(&spmc_shmem_obj_state, v1_0_obj);
 
 		return 0;
@@ -791,7 +1215,7 @@ static int spmc_shmem_check_obj(struct spmc_shmem_obj *obj,
 	const struct ffa_comp_mrd *comp;
 
 	if (obj->desc_filled != obj->desc_size) {
-		ERROR("BUG: %s called on incomplete object (%zu != %zu)\n",
+		ERROR("BUG: %s called on incomplete object (%u != %zu)\n",
 		      __func__, obj->desc_filled, obj->desc_size);
 		panic();
 	}
@@ -1070,6 +1494,11 @@ static long spmc_ffa_fill_desc(struct mailbox *mbox,
 
 		obj->desc.handle = spmc_shmem_obj_state.next_handle++;
 		obj->desc.flags |= mtd_flag;
+
+		if (spmc_shmem_obj_index_add(&spmc_shmem_obj_state, obj) != 0) {
+			ret = FFA_ERROR_NO_MEMORY;
+			goto err_arg;
+		}
 	}
 
 	obj->desc_filled += fragment_length;
@@ -1134,9 +1563,16 @@ static long spmc_ffa_fill_desc(struct mailbox *mbox,
 
 		/*
 		 * We're finished with the v1.0 descriptor so free it
-		 * and continue our checks with the new v1.1 descriptor.
+		 * and continue our checks with the new v1.1 descriptor,
+		 * which the handle now refers to.
 		 */
 		mem_handle = obj->desc.handle;
+		if (spmc_shmem_obj_index_add(&spmc_shmem_obj_state,
+					     v1_1_obj) != 0) {
+			spmc_shmem_obj_free(&spmc_shmem_obj_state, v1_1_obj);
+			ret = FFA_ERROR_NO_MEMORY;
+			goto err_arg;
+		}
 		spmc_shmem_obj_free(&spmc_shmem_obj_state, obj);
 		obj = spmc_shmem_obj_lookup(&spmc_shmem_obj_state, mem_handle);
 		if (obj == NULL) {
@@ -1307,7 +1743,7 @@ long spmc_ffa_mem_frag_tx(uint32_t smc_fid,
 	}
 
 	if (obj->desc_filled == obj->desc_size) {
-		WARN("%s: object desc already filled, %zu\n", __func__,
+		WARN("%s: object desc already filled, %u\n", __func__,
 		     obj->desc_filled);
 		ret = FFA_ERROR_INVALID_PARAMETER;
 		goto err_unlock;
@@ -1469,7 +1905,7 @@ spmc_ffa_mem_retrieve_req(uint32_t smc_fid,
 	}
 
 	if (obj->desc_filled != obj->desc_size) {
-		WARN("%s: incomplete object desc filled %zu < size %zu\n",
+		WARN("%s: incomplete object desc filled %u < size %zu\n",
 		     __func__, obj->desc_filled, obj->desc_size);
 		ret = FFA_ERROR_INVALID_PARAMETER;
 		goto err_unlock_all;
@@ -1911,7 +2347,7 @@ int spmc_ffa_mem_reclaim(uint32_t smc_fid,
 	}
 
 	if (obj->desc_filled != obj->desc_size) {
-		WARN("%s: incomplete object desc filled %zu < size %zu\n",
+		WARN("%s: incomplete object desc filled %u < size %zu\n",
 		     __func__, obj->desc_filled, obj->desc_size);
 		ret = FFA_ERROR_INVALID_PARAMETER;
 		goto err_unlock;
@@ -1924,6 +2360,9 @@ int spmc_ffa_mem_reclaim(uint32_t smc_fid,
 	}
 
 	spmc_shmem_obj_free(&spmc_shmem_obj_state, obj);
+#if DEBUG && (LOG_LEVEL >= LOG_LEVEL_VERBOSE)
+	spmc_shmem_obj_dump_stats(&spmc_shmem_obj_state);
+#endif
 	spin_unlock(&spmc_shmem_obj_state.lock);
 
 	SMC_RET1(handle, FFA_SUCCESS_SMC32);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2022-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -31,19 +31,44 @@ struct ffa_mem_relinquish_descriptor {
 CASSERT(sizeof(struct ffa_mem_relinquish_descriptor) == 16,
 	assert_ffa_mem_relinquish_descriptor_size_mismatch);
 
+/* Number of size classes of free objects in the backing store. */
+#define SPMC_SHMEM_FREE_CLASSES		20U
+
+struct spmc_shmem_obj;
+
 /**
  * struct spmc_shmem_obj_state - Global state.
  * @data:           Backing store for spmc_shmem_obj objects.
  * @data_size:      The size allocated for the backing store.
- * @allocated:      Number of bytes allocated in @data.
+ * @allocated:      Number of bytes used at the start of @data, by allocated
+ *                  and free objects.
+ * @last_size:      Size of the last object in @data, 0 if there is none.
  * @next_handle:    Handle used for next allocated object.
+ * @index:          Open-addressed hash table mapping the handle of each
+ *                  object to its offset in @data plus one, 0 if unused.
+ *                  Carved from the end of the backing store.
+ * @index_slots:    Number of entries in @index, a power of two.
+ * @index_count:    Number of used entries in @index.
+ * @free_list:      Lists of free objects below @allocated, segregated by
+ *                  power of two size classes.
+ * @free_bytes:     Total size of the objects in @free_list, in debug builds.
+ * @free_count:     Number of objects in @free_list, in debug builds.
  * @lock:           Lock protecting all state in this file.
  */
 struct spmc_shmem_obj_state {
 	uint8_t *data;
 	size_t data_size;
 	size_t allocated;
+	size_t last_size;
 	uint64_t next_handle;
+	uint32_t *index;
+	size_t index_slots;
+	size_t index_count;
+	struct spmc_shmem_obj *free_list[SPMC_SHMEM_FREE_CLASSES];
+#if DEBUG
+	size_t free_bytes;
+	size_t free_count;
+#endif
 	spinlock_t lock;
 };
 
@@ -51,6 +76,8 @@ extern struct spmc_shmem_obj_state spmc_shmem_obj_state;
 extern int plat_spmc_shmem_begin(struct ffa_mtd *desc);
 extern int plat_spmc_shmem_reclaim(struct ffa_mtd *desc);
 
+int spmc_shmem_obj_state_init(struct spmc_shmem_obj_state *state);
+
 long spmc_ffa_mem_send(uint32_t smc_fid,
 		       bool secure_origin,
 		       uint64_t total_length,